@@ -0,0 +1,209 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       benchmark.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `benchmark.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "benchmark.h"
+#include "boardCore.h"
+#include "boardSolver.h"
+#include "gameboard.h"
+
+#include <QElapsedTimer>
+#include <QTextStream>
+
+#include <memory>
+
+#ifdef Q_OS_LINUX
+#include <QFile>
+#include <unistd.h>
+#endif
+
+//----------------------------
+//  LOCAL DEFINITIONS
+//----------------------------
+
+namespace
+{
+	/// resident set size of the process in bytes, or 0 where the platform doesn't tell
+	quint64 residentBytes()
+	{
+#ifdef Q_OS_LINUX
+		QFile statm("/proc/self/statm");
+		if (!statm.open(QIODevice::ReadOnly))
+			return 0;
+
+		const QList<QByteArray> fields = statm.readAll().split(' ');
+		return fields.size() > 1 ? fields[1].toULongLong() * static_cast<quint64>(sysconf(_SC_PAGESIZE)) : 0;
+#else
+		return 0;
+#endif
+	}
+
+	struct TopologyRun
+	{
+		quint32 won            = 0;
+		quint64 contradictions = 0;
+	};
+
+	/// plays games on `Topology` the way the solver would, revealing what it proves safe or else the cell least likely
+	/// a mine, and counts every place the core and the solver disagree about the neighbors: a count that isn't the
+	/// mines around the cell, an opening the flood fill left closed, or a proof the mines contradict
+	template <class Topology>
+	TopologyRun playSolved()
+	{
+		TopologyRun run;
+		for (quint32 game = 0; game < Benchmark::TOPOLOGY_GAMES; ++game)
+		{
+			BasicBoardCore<Topology>   core(Benchmark::TOPOLOGY_ROWS, Benchmark::TOPOLOGY_COLUMNS, Benchmark::TOPOLOGY_MINES);
+			const BoardCoreBase::Index firstClick = core.index(Benchmark::TOPOLOGY_ROWS / 2, Benchmark::TOPOLOGY_COLUMNS / 2);
+			core.placeMines(firstClick, Benchmark::BENCHMARK_SEED + game);
+			core.reveal(firstClick);
+
+			BasicBoardSolver<Topology> solver(core);
+			core.clearChanges();
+			while (core.state() == BoardCoreBase::State::InProgress)
+			{
+				BoardCoreBase::Index next = BoardCoreBase::NoCell;
+				double               risk = 2.0;
+				for (BoardCoreBase::Index cell = 0; cell < core.cellCount() && risk > 0.0; ++cell)
+				{
+					if (core.isRevealed(cell) || solver.knowledge(cell) == BasicBoardSolver<Topology>::Knowledge::Mine)
+						continue;
+					if (const double probability = solver.mineProbability(cell); probability < risk)
+					{
+						next = cell;
+						risk = probability;
+					}
+				}
+				if (next == BoardCoreBase::NoCell)
+					break;
+
+				core.reveal(next);
+				solver.update();
+				core.clearChanges();
+			}
+
+			for (BoardCoreBase::Index cell = 0; cell < core.cellCount(); ++cell)
+			{
+				unsigned int mines  = 0;
+				bool         closed = false;
+				core.forEachNeighbor(cell,
+									 [&](BoardCoreBase::Index neighbor)
+									 {
+										 mines += core.isMine(neighbor) ? 1 : 0;
+										 closed |= !core.isRevealed(neighbor);
+									 });
+
+				const auto knowledge = solver.knowledge(cell);
+				run.contradictions += !core.isMine(cell) && core.adjacentMines(cell) != mines;
+				run.contradictions += !core.isMine(cell) && core.isRevealed(cell) && !mines && closed;
+				run.contradictions += knowledge == BasicBoardSolver<Topology>::Knowledge::Safe && core.isMine(cell);
+				run.contradictions += knowledge == BasicBoardSolver<Topology>::Knowledge::Mine && !core.isMine(cell);
+			}
+			run.won += core.state() == BoardCoreBase::State::Victory;
+		}
+		return run;
+	}
+} // namespace
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+int Benchmark::run()
+{
+	QTextStream  out(stdout);
+	const double cells = static_cast<double>(ROWS) * COLUMNS;
+	bool         passed = true;
+
+	auto check = [&](const char* name, double value, double budget, const char* unit)
+	{
+		const bool ok = value <= budget;
+		out << Qt::left << qSetFieldWidth(28) << name << qSetFieldWidth(0) << QString::number(value, 'f', 1) << ' ' << unit
+			<< " (budget " << budget << ' ' << unit << ")" << (ok ? "" : "  FAILED") << Qt::endl;
+		passed &= ok;
+	};
+
+	const quint64 residentBefore = residentBytes();
+	QElapsedTimer timer;
+
+	// the board the GUI would show, with a core and a view of pooled tiles
+	timer.start();
+	auto board = std::make_unique<GameBoard>(ROWS, COLUMNS, MINES);
+	const qint64 buildMs = timer.elapsed();
+
+	// a new game on an existing board, up to the point where the first click has placed the mines
+	timer.restart();
+	board->reset(MINES);
+	board->placeMines(0);
+	const qint64 newGameMs = timer.elapsed();
+
+	// the same on the bare core, with a fixed seed so every run plays the same cascade
+	BoardCore core(ROWS, COLUMNS, MINES);
+	const BoardCore::Index firstClick = core.index(ROWS / 2, COLUMNS / 2);
+	timer.restart();
+	core.reset(MINES);
+	core.placeMines(firstClick, BENCHMARK_SEED);
+	const qint64 coreNewGameMs = timer.elapsed();
+
+	// the scripted game: open the first cascade, then every remaining safe cell in order
+	timer.restart();
+	core.reveal(firstClick);
+	for (BoardCore::Index cell = 0; cell < core.cellCount() && core.state() == BoardCore::State::InProgress; ++cell)
+	{
+		if (!core.isMine(cell))
+			core.reveal(cell);
+		core.clearChanges();
+	}
+	const qint64 playMs = timer.elapsed();
+
+	const quint64 residentAfter = residentBytes();
+	const quint64 coreBytes     = core.memoryUsage();
+
+	timer.restart();
+	board.reset();
+	const qint64 teardownMs = timer.elapsed();
+
+	out << "Large board: " << ROWS << " x " << COLUMNS << ", " << MINES << " mines" << Qt::endl;
+	out << "  build " << buildMs << " ms, play " << playMs << " ms, teardown " << teardownMs << " ms" << Qt::endl;
+	check("new game (board)", static_cast<double>(newGameMs), MAX_NEW_GAME_MS, "ms");
+	check("new game (core)", static_cast<double>(coreNewGameMs), MAX_NEW_GAME_MS, "ms");
+	check("core memory per cell", static_cast<double>(coreBytes) / cells, MAX_BYTES_PER_CELL, "bytes");
+	if (residentBefore && residentAfter)
+		check("resident memory per cell", static_cast<double>(residentAfter - residentBefore) / cells, MAX_BYTES_PER_CELL, "bytes");
+
+	if (core.state() != BoardCore::State::Victory)
+	{
+		out << "scripted game did not end in a victory  FAILED" << Qt::endl;
+		passed = false;
+	}
+
+	// every other topology, played by the solver on a small board, where the two have to agree on the neighbors
+	auto checkTopology = [&](const char* name, const TopologyRun& run)
+	{
+		out << Qt::left << qSetFieldWidth(28) << name << qSetFieldWidth(0) << run.won << " of " << TOPOLOGY_GAMES << " won, "
+			<< run.contradictions << " contradictions" << (run.contradictions ? "  FAILED" : "") << Qt::endl;
+		passed &= !run.contradictions;
+	};
+	out << "Topologies: " << TOPOLOGY_ROWS << " x " << TOPOLOGY_COLUMNS << ", " << TOPOLOGY_MINES << " mines" << Qt::endl;
+	checkTopology("rectangular", playSolved<RectangularTopology>());
+	checkTopology("toroidal", playSolved<ToroidalTopology>());
+	checkTopology("hexagonal", playSolved<HexagonalTopology>());
+	checkTopology("knight", playSolved<KnightTopology>());
+
+	return passed ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       benchmark.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `Benchmark` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include <QtGlobal>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: Benchmark
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Scripted large-board run that enforces the scaling budgets.
+/// @details Run with `minesweeper --benchmark`. It builds a 4-million-cell board, starts a new game on it, plays a
+///          scripted cascade through to victory and tears it down again, then compares the new-game latency and the
+///          memory per cell against the budgets below. It then plays `TOPOLOGY_GAMES` games on each neighbor
+///          topology with the solver choosing the moves, and checks that the core's counts and flood fills and the
+///          solver's proofs agree with the mines. The exit code is non-zero when a budget is exceeded or a check
+///          fails, and the run is registered with CTest as `large_board_budgets`, so `ctest` enforces them.
+//----------------------------------------------------------------------------------------------------------------------
+class Benchmark
+{
+public:
+
+	static constexpr quint32 ROWS                 = 2000;
+	static constexpr quint32 COLUMNS              = 2000;
+	static constexpr quint32 MINES                = ROWS * COLUMNS / 6;
+	static constexpr qint64  MAX_NEW_GAME_MS      = 100; ///< budget for starting a new game, including placing the mines
+	static constexpr quint64 MAX_BYTES_PER_CELL   = 64;  ///< budget for the memory of a board, per cell
+	static constexpr quint64 BENCHMARK_SEED       = 0x5EED;
+	static constexpr quint32 TOPOLOGY_ROWS        = 24;
+	static constexpr quint32 TOPOLOGY_COLUMNS     = 30;
+	static constexpr quint32 TOPOLOGY_MINES       = 120;
+	static constexpr quint32 TOPOLOGY_GAMES       = 20; ///< per topology
+
+public:
+
+	static int run();
+};
+
+#endif // BENCHMARK_H
\ No newline at end of file
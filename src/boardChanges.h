@@ -0,0 +1,62 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       boardChanges.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `BoardChanges` Struct.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef BOARDCHANGES_H
+#define BOARDCHANGES_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include <QRect>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      STRUCT: BoardChanges
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Everything that changed on a `GameBoard` during one event loop turn.
+/// @details The board accumulates changes as tiles are revealed and flagged and delivers them in a single batch, so
+///          a cascade that touches a thousand cells updates the counters and the view once instead of a thousand
+///          times.
+//----------------------------------------------------------------------------------------------------------------------
+struct BoardChanges
+{
+	QRect dirtyCells;        ///< bounding box of the changed cells, in cell coordinates (x = column, y = row)
+	int   flagDelta     = 0; ///< change in the number of flags on the board
+	int   revealedDelta = 0; ///< change in the number of revealed tiles
+	bool  victory       = false;
+	bool  defeat        = false;
+	bool  resumed       = false; ///< an undo took back the end of the game
+
+	void markDirty(unsigned int row, unsigned int column) { dirtyCells |= QRect(static_cast<int>(column), static_cast<int>(row), 1, 1); }
+
+	[[nodiscard]] bool isEmpty() const { return dirtyCells.isNull() && !flagDelta && !revealedDelta && !victory && !defeat && !resumed; }
+};
+
+#endif // BOARDCHANGES_H
\ No newline at end of file
@@ -0,0 +1,836 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       boardCore.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `boardCore.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "boardCore.h"
+#include "splitMix64.h"
+#include "trace.h"
+
+#include <QtEndian>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+//----------------------------
+//  LOCAL DEFINITIONS
+//----------------------------
+
+namespace
+{
+	/// beyond this many changed cells per batch, the view is better off redrawing everything
+	constexpr size_t MAX_CHANGED_CELLS = 1 << 20;
+
+	/// bound on the cell changes the history keeps. Past it, the oldest steps are dropped.
+	constexpr size_t MAX_HISTORY_CHANGES = 1 << 20;
+
+	constexpr quint64 LOWEST_BITS = 0x0101010101010101; ///< the lowest bit of each of eight bytes
+
+	/// each bit of `bits` in the lowest bit of a byte of its own, the first bit in the first byte
+	constexpr quint64 spread(quint8 bits) noexcept
+	{
+		// a copy of the byte in every byte keeps only its own bit, which is then carried down to the lowest one
+		const quint64 own = (bits * LOWEST_BITS) & 0x8040201008040201;
+		return ((own | ((own & 0x7F7F7F7F7F7F7F7F) + 0x7F7F7F7F7F7F7F7F)) >> 7) & LOWEST_BITS;
+	}
+} // namespace
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+template <class Topology>
+BasicBoardCore<Topology>::BasicBoardCore(quint32 rows, quint32 columns, quint32 mines)
+	: m_rows(rows)
+	, m_columns(columns)
+	, m_mines(mines)
+	, m_cells(static_cast<size_t>(rows) * columns, 0)
+{
+	reset(mines);
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::reset(quint32 mines)
+{
+	std::fill(m_cells.begin(), m_cells.end(), quint8{0});
+
+	// the first click is always safe, so there has to be at least one cell without a mine
+	m_mines         = std::min<quint32>(mines, cellCount() ? cellCount() - 1 : 0);
+	m_seed          = 0;
+	m_firstCell     = NoCell;
+	m_state         = State::Unstarted;
+	m_flagCount     = 0;
+	m_revealedCount = 0;
+	m_detonatedCell = NoCell;
+	m_metrics       = {};
+	m_floodStack.clear();
+	m_changes.clear();
+	m_steps.clear();
+	m_doneSteps = 0;
+	clearChanges();
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::resize(quint32 rows, quint32 columns, quint32 mines)
+{
+	// the cell storage keeps its capacity, so going back to a smaller board and up again does not allocate
+	m_rows    = rows;
+	m_columns = columns;
+	m_cells.resize(static_cast<size_t>(rows) * columns);
+	reset(mines);
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::placeMines(Index safeCell, quint64 seed)
+{
+	TRACE_SCOPE("BoardCore::placeMines");
+
+	m_seed      = seed;
+	m_firstCell = safeCell;
+	SplitMix64 random(seed);
+
+	// keep the first click and its neighbors clear, unless the board is too crowded for that
+	std::array<Index, Topology::MAX_NEIGHBORS + 1> safeCells{};
+	size_t                                         safeCount = 0;
+	safeCells[safeCount++]                                   = safeCell;
+	forEachNeighbor(safeCell, [&](Index neighbor) { safeCells[safeCount++] = neighbor; });
+	if (m_mines > cellCount() - safeCount)
+		safeCount = 1;
+
+	auto isSafe = [&](Index cell) { return std::find(safeCells.begin(), safeCells.begin() + safeCount, cell) != safeCells.begin() + safeCount; };
+
+	// rejection sampling is O(mines) while the board is sparse. On a dense board, fill every candidate and clear the
+	// surplus instead, so the sampling never has to hunt for the last few free cells.
+	const quint32 candidates = cellCount() - static_cast<quint32>(safeCount);
+	if (m_mines <= candidates / 2)
+	{
+		for (quint32 placed = 0; placed < m_mines;)
+		{
+			const auto cell = static_cast<Index>(random.bounded(cellCount()));
+			if ((m_cells[cell] & MineBit) || isSafe(cell))
+				continue;
+			m_cells[cell] |= MineBit;
+			++placed;
+		}
+	}
+	else
+	{
+		for (Index cell = 0; cell < cellCount(); ++cell)
+		{
+			if (!isSafe(cell))
+				m_cells[cell] |= MineBit;
+		}
+		for (quint32 cleared = 0; cleared < candidates - m_mines;)
+		{
+			const auto cell = static_cast<Index>(random.bounded(cellCount()));
+			if (!(m_cells[cell] & MineBit))
+				continue;
+			m_cells[cell] &= ~MineBit;
+			++cleared;
+		}
+	}
+
+	countAdjacentMines();
+	countThreeBV();
+
+	m_state = State::InProgress;
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::placeMines(std::span<const Index> mines)
+{
+	TRACE_SCOPE("BoardCore::placeMines");
+
+	m_seed      = 0;
+	m_firstCell = NoCell;
+	m_mines     = 0;
+	for (const Index cell : mines)
+	{
+		if (cell < cellCount() && !(m_cells[cell] & MineBit))
+		{
+			m_cells[cell] |= MineBit;
+			++m_mines;
+		}
+	}
+
+	countAdjacentMines();
+	countThreeBV();
+
+	m_state = State::InProgress;
+}
+
+template <class Topology>
+template <class Value, class Apply>
+void BasicBoardCore<Topology>::sumNeighborhoods(Value value, Apply apply)
+{
+	static_assert(Topology::SEPARABLE);
+
+	// the 3x3 sum is separable: first the values in each cell's row neighborhood, then three of those rows added up.
+	// Both are straight loops over contiguous memory that the compiler vectorizes, which is what keeps a new game on
+	// a large board within budget. The sum includes the cell itself.
+	const size_t        columns = m_columns;
+	std::vector<quint8> rowSums(3 * (columns + 2), 0);
+
+	auto sumRow = [&](quint32 row, quint8* out)
+	{
+		const quint8* cells = m_cells.data() + static_cast<size_t>(row) * columns;
+		for (size_t c = 0; c < columns; ++c)
+			out[c + 1] = value(cells[c]);
+		for (size_t c = 0; c < columns; ++c)
+			out[c] = out[c] + out[c + 1] + out[c + 2];
+	};
+
+	quint8* above   = rowSums.data();
+	quint8* current = above + columns + 2;
+	quint8* below   = current + columns + 2;
+	std::fill(above, above + columns + 2, quint8{0});
+	sumRow(0, current);
+
+	for (quint32 r = 0; r < m_rows; ++r)
+	{
+		if (r + 1 < m_rows)
+		{
+			below[0] = below[columns + 1] = 0;
+			sumRow(r + 1, below);
+		}
+		else
+		{
+			std::fill(below, below + columns + 2, quint8{0});
+		}
+
+		quint8* cells = m_cells.data() + static_cast<size_t>(r) * columns;
+		for (size_t c = 0; c < columns; ++c)
+			apply(cells[c], static_cast<quint8>(above[c] + current[c] + below[c]));
+
+		std::swap(above, current);
+		std::swap(current, below);
+	}
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::countAdjacentMines()
+{
+	TRACE_SCOPE("BoardCore::countAdjacentMines");
+
+	if constexpr (Topology::SEPARABLE)
+	{
+		sumNeighborhoods([](quint8 bits) -> quint8 { return (bits & MineBit) >> 4; },
+						 [](quint8& bits, quint8 mines) { bits |= static_cast<quint8>(mines - ((bits & MineBit) >> 4)); });
+	}
+	else
+	{
+		// other neighborhoods have no such shortcut, each mine adds itself to the count of its neighbors
+		for (Index cell = 0; cell < cellCount(); ++cell)
+		{
+			if (m_cells[cell] & MineBit)
+				forEachNeighbor(cell, [this](Index neighbor) { ++m_cells[neighbor]; });
+		}
+	}
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::countThreeBV()
+{
+	TRACE_SCOPE("BoardCore::countThreeBV");
+
+	// the 3BV is the clicks a perfect game takes: one for each opening, and one for each number without an empty
+	// neighbor, an island. Both are labeled in linear time.
+	m_metrics = {};
+
+	auto isEmpty  = [](quint8 bits) -> quint8 { return (bits & (MineBit | AdjacentMask)) == 0; };
+	auto isNumber = [](quint8 bits) -> quint8 { return ((bits & AdjacentMask) != 0) & ((bits & MineBit) == 0); };
+	if constexpr (Topology::SEPARABLE)
+	{
+		// on the plain square both are straight passes: the empty cells are marked along with the islands, and the
+		// openings counted from the runs of empty cells in each row
+		sumNeighborhoods(isEmpty, [&](quint8& bits, quint8 empty)
+						 { bits |= static_cast<quint8>(((isNumber(bits) & (empty == 0)) | isEmpty(bits)) << 7); });
+		m_metrics.threeBV = countThreeBVSeparable();
+		return;
+	}
+
+	for (Index cell = 0; cell < cellCount(); ++cell)
+	{
+		if (!isNumber(m_cells[cell]))
+			continue;
+
+		bool island = true;
+		forEachNeighbor(cell, [&](Index neighbor) { island &= !isEmpty(m_cells[neighbor]); });
+		m_cells[cell] |= island ? ThreeBVBit : 0;
+	}
+
+	// then every opening is labeled by a flood from the first of its empty cells met
+	for (Index cell = 0; cell < cellCount(); ++cell)
+	{
+		const quint8 bits = m_cells[cell];
+		if (bits & (MineBit | AdjacentMask))
+		{
+			m_metrics.threeBV += (bits & ThreeBVBit) ? 1 : 0;
+			continue;
+		}
+		if (bits & ThreeBVBit)
+			continue;
+
+		++m_metrics.threeBV;
+		m_cells[cell] |= ThreeBVBit;
+		m_floodStack.push_back(cell);
+		while (!m_floodStack.empty())
+		{
+			const Index next = m_floodStack.back();
+			m_floodStack.pop_back();
+
+			forEachNeighbor(next,
+							[this](Index neighbor)
+							{
+								if (!(m_cells[neighbor] & (MineBit | AdjacentMask | ThreeBVBit)))
+								{
+									m_cells[neighbor] |= ThreeBVBit;
+									m_floodStack.push_back(neighbor);
+								}
+							});
+		}
+	}
+}
+
+template <class Topology>
+quint32 BasicBoardCore<Topology>::countThreeBVSeparable() const
+{
+	// only for the plain square, where the cells touching a run in the row above are the run widened by one. Each
+	// run of empty cells in a row starts out as an opening of its own, and merges with every run of the row
+	// above that it touches, diagonals included. What is left once every row is done are the connected openings.
+	// The islands, already marked, are counted on the way.
+	struct Run
+	{
+		quint32 begin;
+		quint32 end;
+		Index   id;
+	};
+	std::vector<Index> parent;
+	std::vector<Run>   above;
+	std::vector<Run>   current;
+	quint32            threeBV = 0;
+
+	auto find = [&parent](Index id)
+	{
+		while (parent[id] != id)
+			id = parent[id] = parent[parent[id]];
+		return id;
+	};
+
+	for (quint32 r = 0; r < m_rows; ++r)
+	{
+		const quint8* cells = m_cells.data() + static_cast<size_t>(r) * m_columns;
+		size_t        first = 0; ///< of the runs above, the first that can still touch one in this row
+		current.clear();
+		for (quint32 c = 0; c < m_columns;)
+		{
+			if (cells[c] & (MineBit | AdjacentMask))
+			{
+				threeBV += (cells[c] & ThreeBVBit) >> 7;
+				++c;
+				continue;
+			}
+
+			const quint32 begin = c;
+			while (c < m_columns && !(cells[c] & (MineBit | AdjacentMask)))
+				++c;
+
+			const auto id = static_cast<Index>(parent.size());
+			parent.push_back(id);
+			++threeBV;
+
+			while (first < above.size() && above[first].end < begin)
+				++first;
+			for (size_t k = first; k < above.size() && above[k].begin <= c; ++k)
+			{
+				const Index root   = find(above[k].id);
+				const Index joined = find(id);
+				if (root != joined)
+				{
+					parent[root] = joined;
+					--threeBV;
+				}
+			}
+			current.push_back({begin, c, id});
+		}
+		std::swap(above, current);
+	}
+	return threeBV;
+}
+
+template <class Topology>
+bool BasicBoardCore<Topology>::reveal(Index cell)
+{
+	TRACE_SCOPE("BoardCore::reveal");
+
+	if (m_state != State::InProgress)
+		return false;
+
+	++m_metrics.clicks;
+	if (m_cells[cell] & (RevealedBit | FlaggedBit))
+		return false;
+
+	++m_metrics.effectiveClicks;
+	beginStep();
+	if (m_cells[cell] & MineBit)
+	{
+		detonate(cell);
+	}
+	else
+	{
+		open(cell);
+		flood();
+	}
+
+	updateState();
+	endStep();
+	return true;
+}
+
+template <class Topology>
+bool BasicBoardCore<Topology>::toggleFlag(Index cell)
+{
+	if (m_state != State::InProgress)
+		return false;
+
+	++m_metrics.clicks;
+	if (m_cells[cell] & RevealedBit)
+		return false;
+
+	++m_metrics.effectiveClicks;
+	beginStep();
+	flip(cell, FlaggedBit);
+	m_flagCount = (m_cells[cell] & FlaggedBit) ? m_flagCount + 1 : m_flagCount - 1;
+	recordChange(cell);
+	endStep();
+	return true;
+}
+
+template <class Topology>
+bool BasicBoardCore<Topology>::chord(Index cell)
+{
+	TRACE_SCOPE("BoardCore::chord");
+
+	if (m_state != State::InProgress)
+		return false;
+
+	++m_metrics.clicks;
+	const unsigned int adjacent = adjacentMines(cell);
+	if (!(m_cells[cell] & RevealedBit) || !adjacent || adjacentFlags(cell) != adjacent)
+		return false;
+
+	// a chord with nothing left to open is no action, and doesn't take the place of the steps that were undone
+	bool closed = false;
+	forEachNeighbor(cell, [&](Index neighbor) { closed |= !(m_cells[neighbor] & (RevealedBit | FlaggedBit)); });
+	if (!closed)
+		return false;
+
+	++m_metrics.effectiveClicks;
+	beginStep();
+	forEachNeighbor(cell,
+					[&](Index neighbor)
+					{
+						if (m_cells[neighbor] & (RevealedBit | FlaggedBit))
+							return;
+
+						if (m_cells[neighbor] & MineBit)
+							detonate(neighbor);
+						else
+							open(neighbor);
+					});
+	flood();
+
+	updateState();
+	endStep();
+	return true;
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::revealMines()
+{
+	TRACE_SCOPE("BoardCore::revealMines");
+
+	if (m_state != State::Defeat)
+		return;
+
+	// one pass over the board. Mines that were not flagged are revealed, and so are wrong flags, which leaves them
+	// both flagged and revealed. Correct flags stay as they are.
+	for (Index cell = 0; cell < cellCount(); ++cell)
+	{
+		const quint8 bits = m_cells[cell];
+		if ((bits & RevealedBit) || !(bits & MineBit) == !(bits & FlaggedBit))
+			continue;
+
+		flip(cell, RevealedBit);
+		recordChange(cell);
+	}
+
+	// the mines belong to the step that lost the game, so one undo takes back both
+	if (m_historyEnabled && !m_steps.empty() && !canRedo())
+	{
+		m_steps.back().end   = m_changes.size();
+		m_steps.back().after = snapshot();
+	}
+	else if (m_historyEnabled)
+	{
+		m_changes.resize(m_steps.empty() ? 0 : m_steps.back().end);
+	}
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::packBits(CellBits bit, std::span<quint8> out) const noexcept
+{
+	// eight cells at a time: the bit of each is moved to the bottom of its byte, and one multiplication gathers the
+	// eight of them into the top byte, the first cell lowest
+	const int     shift = std::countr_zero(static_cast<unsigned int>(bit));
+	const size_t  count = std::min<size_t>(out.size(), (cellCount() + 7) / 8);
+	const size_t  whole = std::min<size_t>(count, cellCount() / 8);
+	const quint8* cells = m_cells.data();
+	for (size_t byte = 0; byte < whole; ++byte)
+	{
+		const quint64 lowest = (qFromLittleEndian<quint64>(cells + byte * 8) >> shift) & LOWEST_BITS;
+		out[byte]            = static_cast<quint8>((lowest * 0x0102040810204080) >> 56);
+	}
+	if (whole < count)
+	{
+		quint8 packed = 0;
+		for (size_t cell = whole * 8; cell < cellCount(); ++cell)
+			packed |= static_cast<quint8>(((cells[cell] >> shift) & 1) << (cell - whole * 8));
+		out[whole] = packed;
+	}
+}
+
+template <class Topology>
+bool BasicBoardCore<Topology>::resume(std::span<const quint8> revealed, std::span<const quint8> flagged, std::span<const quint8> threeBV,
+									  const Metrics& metrics)
+{
+	TRACE_SCOPE("BoardCore::resume");
+
+	// the 3BV of the mines placed has to be the one the game was played on, or these aren't its cells
+	const size_t bytes = (cellCount() + 7) / 8;
+	if (m_state != State::InProgress || m_revealedCount || m_flagCount || metrics.threeBV != m_metrics.threeBV ||
+		revealed.size() < bytes || flagged.size() < bytes || threeBV.size() < bytes)
+		return false;
+
+	// a cell that is revealed can't be flagged as well, that only happens once a game is lost. Eight cells are set at
+	// a time, in one straight pass without a flood, since the openings already solved are among the cells unmarked.
+	quint32      revealedMines = 0;
+	quint8*      cells         = m_cells.data();
+	const size_t whole         = cellCount() / 8;
+	auto         setCells      = [&](quint64 eight, size_t byte, quint8 valid)
+	{
+		const quint8 r = revealed[byte] & valid;
+		const quint8 f = flagged[byte] & valid & ~r;
+		const quint8 t = threeBV[byte] & valid;
+		eight          = (eight & ~(LOWEST_BITS << 7)) | (spread(r) << 5) | (spread(f) << 6) | (spread(t) << 7);
+		revealedMines += std::popcount((eight >> 4) & (eight >> 5) & LOWEST_BITS);
+		m_revealedCount += std::popcount(r);
+		m_flagCount += std::popcount(f);
+		return eight;
+	};
+	for (size_t byte = 0; byte < whole; ++byte)
+		qToLittleEndian(setCells(qFromLittleEndian<quint64>(cells + byte * 8), byte, 0xFF), cells + byte * 8);
+	if (const size_t rest = cellCount() - whole * 8)
+	{
+		quint8 tail[8] = {};
+		std::copy(cells + whole * 8, cells + cellCount(), tail);
+		qToLittleEndian(setCells(qFromLittleEndian<quint64>(tail), whole, static_cast<quint8>((1u << rest) - 1)), tail);
+		std::copy(tail, tail + rest, cells + whole * 8);
+	}
+
+	m_revealedCount -= revealedMines;
+	for (Index cell = 0; revealedMines && cell < cellCount(); ++cell)
+	{
+		if ((m_cells[cell] & (MineBit | RevealedBit)) == (MineBit | RevealedBit))
+		{
+			m_detonatedCell = cell;
+			break;
+		}
+	}
+
+	m_metrics                 = metrics;
+	m_metrics.solvedThreeBV   = std::min(metrics.solvedThreeBV, metrics.threeBV);
+	m_metrics.effectiveClicks = std::min(metrics.effectiveClicks, metrics.clicks);
+	updateState();
+
+	setHistoryEnabled(m_historyEnabled);
+	m_changedCells.clear();
+	m_changesOverflowed = true;
+	return true;
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::setHistoryEnabled(bool enabled)
+{
+	m_historyEnabled = enabled;
+	m_changes.clear();
+	m_steps.clear();
+	m_doneSteps = 0;
+}
+
+template <class Topology>
+bool BasicBoardCore<Topology>::undo()
+{
+	TRACE_SCOPE("BoardCore::undo");
+
+	if (!canUndo())
+		return false;
+
+	// flipping the same bits again restores the cells, in O(cells the step changed)
+	const Step&  step  = m_steps[--m_doneSteps];
+	const size_t begin = m_doneSteps ? m_steps[m_doneSteps - 1].end : 0;
+	for (size_t i = step.end; i-- > begin;)
+	{
+		m_cells[m_changes[i].cell] ^= m_changes[i].bits;
+		recordChange(m_changes[i].cell);
+	}
+	restore(step.before);
+	return true;
+}
+
+template <class Topology>
+bool BasicBoardCore<Topology>::redo()
+{
+	TRACE_SCOPE("BoardCore::redo");
+
+	if (!canRedo())
+		return false;
+
+	const size_t begin = m_doneSteps ? m_steps[m_doneSteps - 1].end : 0;
+	const Step&  step  = m_steps[m_doneSteps++];
+	for (size_t i = begin; i < step.end; ++i)
+	{
+		m_cells[m_changes[i].cell] ^= m_changes[i].bits;
+		recordChange(m_changes[i].cell);
+	}
+	restore(step.after);
+	return true;
+}
+
+template <class Topology>
+unsigned int BasicBoardCore<Topology>::adjacentFlags(Index cell) const noexcept
+{
+	unsigned int flags = 0;
+	forEachNeighbor(cell, [&](Index neighbor) { flags += (m_cells[neighbor] & FlaggedBit) ? 1 : 0; });
+	return flags;
+}
+
+template <class Topology>
+quint64 BasicBoardCore<Topology>::memoryUsage() const noexcept
+{
+	return sizeof(*this) + m_cells.capacity() + (m_floodStack.capacity() + m_changedCells.capacity()) * sizeof(Index) +
+		   m_changes.capacity() * sizeof(Change) + m_steps.size() * sizeof(Step);
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::clearChanges() noexcept
+{
+	m_changedCells.clear();
+	m_changesOverflowed = false;
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::flip(Index cell, quint8 bits)
+{
+	// every change to a cell during play goes through here, so the history sees all of them
+	m_cells[cell] ^= bits;
+	if (m_historyEnabled)
+		m_changes.push_back({cell, bits});
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::open(Index cell)
+{
+	flip(cell, RevealedBit);
+	++m_revealedCount;
+	recordChange(cell);
+
+	if (m_cells[cell] & AdjacentMask)
+	{
+		m_metrics.solvedThreeBV += (m_cells[cell] & ThreeBVBit) ? 1 : 0;
+	}
+	else
+	{
+		if (m_cells[cell] & ThreeBVBit)
+			solveOpening(cell);
+		m_floodStack.push_back(cell);
+	}
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::solveOpening(Index cell)
+{
+	// the whole opening is unmarked at once, so a part of it that a flag cut off from the flood doesn't count again
+	// when it is opened later. Each opening is walked once per game, on top of the flood stack, which it leaves as it
+	// was.
+	++m_metrics.solvedThreeBV;
+
+	const size_t base = m_floodStack.size();
+	flip(cell, ThreeBVBit);
+	m_floodStack.push_back(cell);
+	while (m_floodStack.size() > base)
+	{
+		const Index next = m_floodStack.back();
+		m_floodStack.pop_back();
+
+		forEachNeighbor(next,
+						[this](Index neighbor)
+						{
+							if ((m_cells[neighbor] & (MineBit | AdjacentMask | ThreeBVBit)) == ThreeBVBit)
+							{
+								flip(neighbor, ThreeBVBit);
+								m_floodStack.push_back(neighbor);
+							}
+						});
+	}
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::flood()
+{
+	// iterative, so even a cascade across the whole board runs in one batch without deep recursion. Neighbors of a
+	// cell without adjacent mines can never be mines themselves.
+	while (!m_floodStack.empty())
+	{
+		const Index cell = m_floodStack.back();
+		m_floodStack.pop_back();
+
+		forEachNeighbor(cell,
+						[this](Index neighbor)
+						{
+							if (!(m_cells[neighbor] & (RevealedBit | FlaggedBit)))
+								open(neighbor);
+						});
+	}
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::detonate(Index cell)
+{
+	flip(cell, RevealedBit);
+	recordChange(cell);
+
+	if (m_detonatedCell == NoCell)
+		m_detonatedCell = cell;
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::recordChange(Index cell)
+{
+	if (m_changesOverflowed)
+		return;
+
+	if (m_changedCells.size() < MAX_CHANGED_CELLS)
+	{
+		m_changedCells.push_back(cell);
+	}
+	else
+	{
+		m_changesOverflowed = true;
+		m_changedCells.clear();
+	}
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::updateState()
+{
+	if (m_state != State::InProgress)
+		return;
+
+	if (m_detonatedCell != NoCell)
+		m_state = State::Defeat;
+	else if (m_revealedCount == cellCount() - m_mines)
+		m_state = State::Victory;
+}
+
+template <class Topology>
+typename BasicBoardCore<Topology>::Snapshot BasicBoardCore<Topology>::snapshot() const noexcept
+{
+	return {m_state, m_flagCount, m_revealedCount, m_detonatedCell, m_metrics};
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::restore(const Snapshot& snapshot) noexcept
+{
+	m_state         = snapshot.state;
+	m_flagCount     = snapshot.flagCount;
+	m_revealedCount = snapshot.revealedCount;
+	m_detonatedCell = snapshot.detonatedCell;
+
+	// the clicks were made whatever became of them, and the ones that changed nothing were never part of a step
+	const quint32 clicks          = m_metrics.clicks;
+	const quint32 effectiveClicks = m_metrics.effectiveClicks;
+	m_metrics                     = snapshot.metrics;
+	m_metrics.clicks              = clicks;
+	m_metrics.effectiveClicks     = effectiveClicks;
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::beginStep()
+{
+	if (!m_historyEnabled)
+		return;
+
+	// a new action replaces whatever was undone
+	m_steps.resize(m_doneSteps);
+	m_changes.resize(m_steps.empty() ? 0 : m_steps.back().end);
+	m_stepBefore = snapshot();
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::endStep()
+{
+	if (!m_historyEnabled || m_changes.size() == (m_steps.empty() ? 0 : m_steps.back().end))
+		return;
+
+	m_steps.push_back({m_stepBefore, snapshot(), m_changes.size()});
+	m_doneSteps = m_steps.size();
+	trimHistory();
+}
+
+template <class Topology>
+void BasicBoardCore<Topology>::trimHistory()
+{
+	if (m_changes.size() <= MAX_HISTORY_CHANGES)
+		return;
+
+	// the oldest steps go, down to half the bound so this doesn't run again for a while. A step too large to keep
+	// takes the whole history with it.
+	size_t dropped = 0;
+	while (m_changes.size() - m_steps[dropped].end > MAX_HISTORY_CHANGES / 2)
+		++dropped;
+
+	const size_t end = m_steps[dropped].end;
+	m_changes.erase(m_changes.begin(), m_changes.begin() + static_cast<std::ptrdiff_t>(end));
+	m_steps.erase(m_steps.begin(), m_steps.begin() + static_cast<std::ptrdiff_t>(dropped + 1));
+	for (auto& step : m_steps)
+		step.end -= end;
+	m_doneSteps = m_steps.size();
+
+	if (m_steps.empty())
+		m_changes.shrink_to_fit();
+}
+
+//----------------------------
+//  INSTANTIATIONS
+//----------------------------
+
+template class BasicBoardCore<RectangularTopology>;
+template class BasicBoardCore<ToroidalTopology>;
+template class BasicBoardCore<HexagonalTopology>;
+template class BasicBoardCore<KnightTopology>;
\ No newline at end of file
@@ -0,0 +1,255 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       boardCore.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `BoardCore` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef BOARDCORE_H
+#define BOARDCORE_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "topology.h"
+
+#include <QtGlobal>
+
+#include <deque>
+#include <limits>
+#include <span>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: BoardCoreBase
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Types shared by the board cores of every topology.
+//----------------------------------------------------------------------------------------------------------------------
+class BoardCoreBase
+{
+public:
+
+	using Index = quint32;
+
+	static constexpr Index NoCell = std::numeric_limits<Index>::max();
+
+	/// layout of a cell's byte
+	enum CellBits : quint8
+	{
+		AdjacentMask = 0x0F, ///< number of adjacent mines
+		MineBit      = 0x10,
+		RevealedBit  = 0x20,
+		FlaggedBit   = 0x40,
+		ThreeBVBit   = 0x80, ///< a number with no empty neighbor, or an empty cell of an opening not yet solved
+	};
+
+	enum class State : quint8
+	{
+		Unstarted, ///< the mines have not been placed yet
+		InProgress,
+		Victory,
+		Defeat,
+	};
+
+	/// how efficiently a game is being played, kept up to date by every action
+	struct Metrics
+	{
+		quint32 threeBV         = 0; ///< the fewest clicks that clear the board
+		quint32 solvedThreeBV   = 0; ///< of those, the ones done so far
+		quint32 clicks          = 0;
+		quint32 effectiveClicks = 0; ///< clicks that changed the board
+
+		[[nodiscard]] quint32 wastedClicks() const noexcept { return clicks - effectiveClicks; }
+		[[nodiscard]] double  efficiency() const noexcept { return clicks ? 100.0 * solvedThreeBV / clicks : 0.0; } ///< percent
+		[[nodiscard]] double  threeBVPerSecond(double seconds) const noexcept { return seconds > 0.0 ? solvedThreeBV / seconds : 0.0; }
+	};
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: BasicBoardCore
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief The rules of the game, independent of any widgets.
+/// @details The board is a flat, row-major array with one byte per cell. Every action (reveal, flag, chord) runs to
+///          completion synchronously, including any flood fill it causes, and records the cells it changed so a view
+///          can redraw exactly those in one batch.
+///
+///          Placing the mines also labels the board's 3BV, with the spare bit of each cell, and every action keeps the
+///          clicks and the 3BV solved so far up to date, so the metrics of a game cost nothing to read, see `metrics()`.
+///
+///          With the history enabled, for practice, every action can be undone and redone. Each step keeps only the
+///          cells it changed, with the bits it flipped in them, so the states before and after it share every other
+///          cell, and undoing even a cascade across the board costs no more than the cells it opened.
+///
+///          A game can be put aside and continued later from its mines, three bitmaps and its metrics, see `packBits()`
+///          and `resume()`. The counts follow from those cells.
+///
+///          Which cells are neighbors is up to `Topology`, see `topology.h`. The cores of the topologies in there are
+///          instantiated in `boardCore.cpp`.
+//----------------------------------------------------------------------------------------------------------------------
+template <class Topology>
+class BasicBoardCore : public BoardCoreBase
+{
+public:
+
+	BasicBoardCore(quint32 rows, quint32 columns, quint32 mines);
+
+	void reset(quint32 mines);
+	void resize(quint32 rows, quint32 columns, quint32 mines);
+	void placeMines(Index safeCell, quint64 seed);
+	void placeMines(std::span<const Index> mines); ///< a given layout, for games that come from elsewhere
+
+	bool reveal(Index cell);
+	bool toggleFlag(Index cell);
+	bool chord(Index cell);
+	void revealMines(); ///< after a defeat, reveals every unflagged mine and every wrong flag in one batch
+
+	/// the cells with `bit` set, eight to a byte with the first cell in the lowest bit, into `(cellCount() + 7) / 8`
+	/// bytes of `out`
+	void packBits(CellBits bit, std::span<quint8> out) const noexcept;
+
+	/// continues a game whose mines are placed from its revealed, flagged and `ThreeBVBit` cells, packed like
+	/// `packBits()`, and its metrics. The board is reported as changed as a whole, and the history starts over.
+	bool resume(std::span<const quint8> revealed, std::span<const quint8> flagged, std::span<const quint8> threeBV, const Metrics& metrics);
+
+	void               setHistoryEnabled(bool enabled); ///< starts over with an empty history either way
+	[[nodiscard]] bool historyEnabled() const noexcept { return m_historyEnabled; }
+	[[nodiscard]] bool canUndo() const noexcept { return m_doneSteps > 0; }
+	[[nodiscard]] bool canRedo() const noexcept { return m_doneSteps < m_steps.size(); }
+	bool               undo(); ///< takes back the last action, including a defeat, and records the cells it changed
+	bool               redo();
+
+	[[nodiscard]] quint32 rows() const noexcept { return m_rows; }
+	[[nodiscard]] quint32 columns() const noexcept { return m_columns; }
+	[[nodiscard]] quint32 mines() const noexcept { return m_mines; }
+	[[nodiscard]] Index   cellCount() const noexcept { return static_cast<Index>(m_cells.size()); }
+	[[nodiscard]] quint64 seed() const noexcept { return m_seed; }
+	[[nodiscard]] Index   firstCell() const noexcept { return m_firstCell; } ///< kept clear with the seed, `NoCell` for a given layout
+	[[nodiscard]] State   state() const noexcept { return m_state; }
+	[[nodiscard]] quint32 flagCount() const noexcept { return m_flagCount; }
+	[[nodiscard]] quint32 revealedCount() const noexcept { return m_revealedCount; }
+	[[nodiscard]] Index   detonatedCell() const noexcept { return m_detonatedCell; }
+	[[nodiscard]] const Metrics& metrics() const noexcept { return m_metrics; }
+	[[nodiscard]] quint64 memoryUsage() const noexcept;
+
+	[[nodiscard]] Index   index(quint32 row, quint32 column) const noexcept { return row * m_columns + column; }
+	[[nodiscard]] quint32 row(Index cell) const noexcept { return cell / m_columns; }
+	[[nodiscard]] quint32 column(Index cell) const noexcept { return cell % m_columns; }
+
+	[[nodiscard]] bool         isMine(Index cell) const noexcept { return m_cells[cell] & MineBit; }
+	[[nodiscard]] bool         isRevealed(Index cell) const noexcept { return m_cells[cell] & RevealedBit; }
+	[[nodiscard]] bool         isFlagged(Index cell) const noexcept { return m_cells[cell] & FlaggedBit; }
+	[[nodiscard]] unsigned int adjacentMines(Index cell) const noexcept { return m_cells[cell] & AdjacentMask; }
+	[[nodiscard]] unsigned int adjacentFlags(Index cell) const noexcept;
+
+	/// cells changed since the last call to `clearChanges()`. Once too many cells have changed to be worth listing,
+	/// `changesOverflowed()` is set and the view should treat the whole board as changed.
+	[[nodiscard]] const std::vector<Index>& changedCells() const noexcept { return m_changedCells; }
+	[[nodiscard]] bool                      changesOverflowed() const noexcept { return m_changesOverflowed; }
+	void                                    clearChanges() noexcept;
+
+	template <class Function>
+	void forEachNeighbor(Index cell, Function&& function) const
+	{
+		Topology::forEachNeighbor(m_rows, m_columns, row(cell), column(cell), [&](quint32 r, quint32 c) { function(index(r, c)); });
+	}
+
+private:
+
+	template <class Value, class Apply>
+	void sumNeighborhoods(Value value, Apply apply);
+	void countAdjacentMines();
+	void countThreeBV();
+	[[nodiscard]] quint32 countThreeBVSeparable() const;
+	void flip(Index cell, quint8 bits);
+	void open(Index cell);
+	void solveOpening(Index cell);
+	void flood();
+	void detonate(Index cell);
+	void recordChange(Index cell);
+	void updateState();
+
+	/// everything about a game besides its cells
+	struct Snapshot
+	{
+		State   state;
+		quint32 flagCount;
+		quint32 revealedCount;
+		Index   detonatedCell;
+		Metrics metrics; ///< its clicks are left alone by `restore()`
+	};
+
+	/// bits flipped in a cell
+	struct Change
+	{
+		Index  cell;
+		quint8 bits;
+	};
+
+	/// one action that can be undone. Its changes run from the end of the step before it up to `end`.
+	struct Step
+	{
+		Snapshot before;
+		Snapshot after;
+		size_t   end;
+	};
+
+	[[nodiscard]] Snapshot snapshot() const noexcept;
+	void                   restore(const Snapshot& snapshot) noexcept;
+	void                   beginStep();
+	void                   endStep();
+	void                   trimHistory();
+
+private:
+
+	quint32 m_rows;
+	quint32 m_columns;
+	quint32 m_mines;
+	quint64 m_seed      = 0;
+	Index   m_firstCell = NoCell;
+
+	std::vector<quint8> m_cells;
+	std::vector<Index>  m_floodStack;
+	std::vector<Index>  m_changedCells;
+	bool                m_changesOverflowed = false;
+
+	State   m_state         = State::Unstarted;
+	quint32 m_flagCount     = 0;
+	quint32 m_revealedCount = 0;
+	Index   m_detonatedCell = NoCell;
+	Metrics m_metrics;
+
+	bool                m_historyEnabled = false;
+	std::vector<Change> m_changes;       ///< of every step kept, oldest first
+	std::deque<Step>    m_steps;
+	size_t              m_doneSteps = 0; ///< the steps after this many have been undone
+	Snapshot            m_stepBefore{};  ///< of the action in progress
+};
+
+/// the classic rectangular board
+using BoardCore = BasicBoardCore<RectangularTopology>;
+
+#endif // BOARDCORE_H
\ No newline at end of file
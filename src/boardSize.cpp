@@ -0,0 +1,83 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       boardSize.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `boardSize.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "boardSize.h"
+
+#include <QObject>
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+BoardSize BoardSize::preset(HighScore::Difficulty difficulty)
+{
+	switch (difficulty)
+	{
+	case HighScore::intermediate:
+		return {16, 16, 40};
+	case HighScore::expert:
+		return {16, 30, 99};
+	case HighScore::beginner: [[fallthrough]];
+	default:
+		return {9, 9, 10};
+	}
+}
+
+HighScore::Difficulty BoardSize::difficulty() const
+{
+	for (auto difficulty : {HighScore::beginner, HighScore::intermediate, HighScore::expert})
+	{
+		if (*this == preset(difficulty))
+			return difficulty;
+	}
+	return HighScore::custom;
+}
+
+QString BoardSize::name() const
+{
+	switch (difficulty())
+	{
+	case HighScore::beginner:
+		return QObject::tr("Beginner");
+	case HighScore::intermediate:
+		return QObject::tr("Intermediate");
+	case HighScore::expert:
+		return QObject::tr("Expert");
+	default:
+		return QObject::tr("%1 x %2, %3 mines").arg(columns).arg(rows).arg(mines);
+	}
+}
+
+bool BoardSize::isValid() const
+{
+	// the first click is always safe, so a board needs at least one cell without a mine
+	return rows && columns && rows <= MAX_ROWS && columns <= MAX_COLUMNS && mines < cellCount();
+}
+
+QDataStream& operator<<(QDataStream& out, const BoardSize& size)
+{
+	out << size.rows << size.columns << size.mines;
+	return out;
+}
+
+QDataStream& operator>>(QDataStream& in, BoardSize& size)
+{
+	in >> size.rows >> size.columns >> size.mines;
+	return in;
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       boardSize.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `BoardSize` struct.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef BOARDSIZE_H
+#define BOARDSIZE_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "highScore.h"
+
+#include <QDataStream>
+#include <QString>
+
+#include <compare>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      STRUCT: BoardSize
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief The exact dimensions of a game.
+/// @details High scores and statistics are kept per board size, so every custom board gets its own leaderboard
+///          instead of sharing one with every other custom board. The three presets map back to their difficulty.
+//----------------------------------------------------------------------------------------------------------------------
+struct BoardSize
+{
+	static constexpr quint32 MAX_ROWS    = 10000;
+	static constexpr quint32 MAX_COLUMNS = 10000;
+
+	quint32 rows    = 9;
+	quint32 columns = 9;
+	quint32 mines   = 10;
+
+	[[nodiscard]] static BoardSize preset(HighScore::Difficulty difficulty);
+
+	[[nodiscard]] HighScore::Difficulty difficulty() const;
+	[[nodiscard]] QString               name() const;
+	[[nodiscard]] quint64               cellCount() const { return static_cast<quint64>(rows) * columns; }
+	[[nodiscard]] bool                  isValid() const;
+
+	auto operator<=>(const BoardSize&) const = default;
+};
+
+QDataStream& operator<<(QDataStream& out, const BoardSize& size);
+QDataStream& operator>>(QDataStream& in, BoardSize& size);
+
+#endif // BOARDSIZE_H
\ No newline at end of file
@@ -0,0 +1,469 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       boardSolver.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `boardSolver.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "boardSolver.h"
+#include "trace.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+//----------------------------
+//  LOCAL DEFINITIONS
+//----------------------------
+
+namespace
+{
+	/// below this, or this close to 1, an exact probability is a proof
+	constexpr double CERTAIN = 1e-12;
+
+	/// weights of each total number of mines over two independent groups
+	std::vector<double> convolve(const std::vector<double>& a, const std::vector<double>& b)
+	{
+		std::vector<double> result(a.size() + b.size() - 1, 0.0);
+		for (size_t i = 0; i < a.size(); ++i)
+		{
+			for (size_t j = 0; j < b.size(); ++j)
+				result[i + j] += a[i] * b[j];
+		}
+
+		// only the ratios matter, and without this the products of many groups overflow
+		if (const double largest = *std::max_element(result.begin(), result.end()); largest > 0.0)
+		{
+			for (auto& weight : result)
+				weight /= largest;
+		}
+		return result;
+	}
+
+	double logChoose(quint64 n, quint64 k) { return std::lgamma(n + 1.0) - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0); }
+} // namespace
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+template <class Topology>
+BasicBoardSolver<Topology>::BasicBoardSolver(const Core& core)
+	: m_core(core)
+	, m_knowledge(core.cellCount(), Knowledge::Unknown)
+	, m_revealed(core.cellCount(), false)
+	, m_unknownCells(core.cellCount())
+{
+	for (Index cell = 0; cell < core.cellCount(); ++cell)
+	{
+		if (core.isRevealed(cell))
+			reveal(cell);
+	}
+	propagate();
+}
+
+template <class Topology>
+void BasicBoardSolver<Topology>::update()
+{
+	TRACE_SCOPE("BoardSolver::update");
+
+	// a flood too large to be listed cell by cell means looking at the whole board again
+	if (m_core.changesOverflowed())
+	{
+		for (Index cell = 0; cell < m_core.cellCount(); ++cell)
+		{
+			if (m_core.isRevealed(cell))
+				reveal(cell);
+		}
+	}
+	else
+	{
+		for (const Index cell : m_core.changedCells())
+		{
+			if (m_core.isRevealed(cell))
+				reveal(cell);
+		}
+	}
+	propagate();
+}
+
+template <class Topology>
+double BasicBoardSolver<Topology>::mineProbability(Index cell)
+{
+	switch (m_knowledge[cell])
+	{
+	case Knowledge::Safe:
+		return 0.0;
+	case Knowledge::Mine:
+		return 1.0;
+	default:
+		break;
+	}
+
+	if (!m_enumerated)
+		enumerate();
+
+	const auto frontier = m_frontier.find(cell);
+	return frontier != m_frontier.end() ? frontier->second : m_interior;
+}
+
+template <class Topology>
+void BasicBoardSolver<Topology>::reveal(Index cell)
+{
+	// a revealed mine ends the game, it says nothing about its neighbors
+	if (m_revealed[cell] || m_core.isMine(cell))
+		return;
+
+	m_revealed[cell] = true;
+	if (m_knowledge[cell] == Knowledge::Unknown)
+	{
+		m_knowledge[cell] = Knowledge::Safe;
+		--m_unknownCells;
+	}
+	m_pending.push_back(cell);
+	m_constraints.push_back(cell);
+	m_enumerated = false;
+}
+
+template <class Topology>
+void BasicBoardSolver<Topology>::decide(Index cell, Knowledge knowledge)
+{
+	if (m_knowledge[cell] != Knowledge::Unknown)
+		return;
+
+	m_knowledge[cell] = knowledge;
+	--m_unknownCells;
+	if (knowledge == Knowledge::Mine)
+		++m_knownMines;
+	m_enumerated = false;
+
+	m_core.forEachNeighbor(cell,
+						   [this](Index neighbor)
+						   {
+							   if (m_revealed[neighbor])
+								   m_pending.push_back(neighbor);
+						   });
+}
+
+template <class Topology>
+void BasicBoardSolver<Topology>::propagate()
+{
+	TRACE_SCOPE("BoardSolver::propagate");
+
+	while (!m_pending.empty())
+	{
+		const Index cell = m_pending.back();
+		m_pending.pop_back();
+
+		int mines   = static_cast<int>(m_core.adjacentMines(cell));
+		int unknown = 0;
+		m_core.forEachNeighbor(cell,
+							   [&](Index neighbor)
+							   {
+								   if (m_knowledge[neighbor] == Knowledge::Mine)
+									   --mines;
+								   else if (m_knowledge[neighbor] == Knowledge::Unknown)
+									   ++unknown;
+							   });
+		if (!unknown || (mines != 0 && mines != unknown))
+			continue;
+
+		const Knowledge knowledge = mines == 0 ? Knowledge::Safe : Knowledge::Mine;
+		m_core.forEachNeighbor(cell, [&](Index neighbor) { decide(neighbor, knowledge); });
+	}
+}
+
+template <class Topology>
+void BasicBoardSolver<Topology>::enumerate()
+{
+	TRACE_SCOPE("BoardSolver::enumerate");
+
+	m_exact = true;
+	m_frontier.clear();
+
+	// the numbers with nothing left to say are done for good
+	std::erase_if(m_constraints,
+				  [this](Index number)
+				  {
+					  bool open = false;
+					  m_core.forEachNeighbor(number, [&](Index neighbor) { open |= m_knowledge[neighbor] == Knowledge::Unknown; });
+					  return !open;
+				  });
+
+	// the frontier: every undecided cell next to a number, and what each number still needs among them
+	std::vector<Index>                 cells;
+	std::unordered_map<Index, quint32> position;
+	std::vector<Constraint>            constraints(m_constraints.size());
+	for (size_t c = 0; c < m_constraints.size(); ++c)
+	{
+		const Index number     = m_constraints[c];
+		constraints[c].mines   = static_cast<int>(m_core.adjacentMines(number));
+		m_core.forEachNeighbor(number,
+							   [&](Index neighbor)
+							   {
+								   if (m_knowledge[neighbor] == Knowledge::Mine)
+									   --constraints[c].mines;
+								   else if (m_knowledge[neighbor] == Knowledge::Unknown)
+								   {
+									   const auto [it, inserted] = position.try_emplace(neighbor, static_cast<quint32>(cells.size()));
+									   if (inserted)
+										   cells.push_back(neighbor);
+									   constraints[c].cells.push_back(it->second);
+								   }
+							   });
+	}
+
+	// cells that share a number depend on each other, the groups that share none are independent
+	std::vector<quint32> parent(cells.size());
+	std::iota(parent.begin(), parent.end(), 0u);
+	auto root = [&parent](quint32 cell)
+	{
+		while (parent[cell] != cell)
+			cell = parent[cell] = parent[parent[cell]];
+		return cell;
+	};
+	for (const auto& constraint : constraints)
+	{
+		for (const quint32 cell : constraint.cells)
+			parent[root(cell)] = root(constraint.cells.front());
+	}
+
+	struct Group
+	{
+		std::vector<quint32> cells;
+		std::vector<quint32> constraints;
+		std::vector<double>  counts;     ///< arrangements by number of mines
+		std::vector<double>  cellCounts; ///< arrangements by cell and number of mines with a mine in that cell
+		bool                 exact = true;
+	};
+
+	std::vector<Group>   groups;
+	std::vector<quint32> groupOf(cells.size(), 0);
+	std::vector<quint32> local(cells.size(), 0);
+	{
+		std::unordered_map<quint32, quint32> groupOfRoot;
+		for (quint32 cell = 0; cell < cells.size(); ++cell)
+		{
+			const auto [it, inserted] = groupOfRoot.try_emplace(root(cell), static_cast<quint32>(groups.size()));
+			if (inserted)
+				groups.emplace_back();
+			groupOf[cell] = it->second;
+			local[cell]   = static_cast<quint32>(groups[it->second].cells.size());
+			groups[it->second].cells.push_back(cell);
+		}
+		for (quint32 c = 0; c < constraints.size(); ++c)
+		{
+			if (!constraints[c].cells.empty())
+				groups[groupOf[constraints[c].cells.front()]].constraints.push_back(c);
+		}
+	}
+
+	const qint64 remaining = std::max<qint64>(0, static_cast<qint64>(m_core.mines()) - m_knownMines);
+	for (auto& group : groups)
+	{
+		const size_t size = group.cells.size();
+		group.counts.assign(size + 1, 0.0);
+		group.cellCounts.assign(size * (size + 1), 0.0);
+
+		// what each number still needs and how many of its cells are still open, as the search assigns them
+		std::vector<std::vector<quint32>> constraintsOf(size);
+		std::vector<int>                  need(constraints.size());
+		std::vector<int>                  open(constraints.size());
+		for (const quint32 c : group.constraints)
+		{
+			need[c] = constraints[c].mines;
+			open[c] = static_cast<int>(constraints[c].cells.size());
+			for (const quint32 cell : constraints[c].cells)
+				constraintsOf[local[cell]].push_back(c);
+		}
+
+		std::vector<quint8> assignment(size, 0);
+		quint64             branches = 0;
+		group.exact                  = size <= MAX_GROUP_CELLS;
+
+		auto search = [&](auto& self, size_t next, qint64 mines) -> void
+		{
+			if (!group.exact)
+				return;
+			if (++branches > MAX_BRANCHES)
+			{
+				group.exact = false;
+				return;
+			}
+			if (next == size)
+			{
+				group.counts[mines] += 1.0;
+				for (size_t cell = 0; cell < size; ++cell)
+				{
+					if (assignment[cell])
+						group.cellCounts[cell * (size + 1) + mines] += 1.0;
+				}
+				return;
+			}
+
+			for (const quint8 mine : {quint8{0}, quint8{1}})
+			{
+				bool consistent = mines + mine <= remaining;
+				for (const quint32 c : constraintsOf[next])
+				{
+					need[c] -= mine;
+					--open[c];
+					consistent &= need[c] >= 0 && need[c] <= open[c];
+				}
+				if (consistent)
+				{
+					assignment[next] = mine;
+					self(self, next + 1, mines + mine);
+				}
+				for (const quint32 c : constraintsOf[next])
+				{
+					need[c] += mine;
+					++open[c];
+				}
+			}
+		};
+		search(search, 0, 0);
+
+		if (!group.exact)
+		{
+			// estimated: each cell as likely a mine as its numbers say on average, with the expected total
+			m_exact = false;
+			group.counts.assign(size + 1, 0.0);
+			group.cellCounts.assign(size * (size + 1), 0.0);
+
+			std::vector<double> estimate(size, 0.0);
+			std::vector<int>    numbers(size, 0);
+			for (const quint32 c : group.constraints)
+			{
+				for (const quint32 cell : constraints[c].cells)
+				{
+					estimate[local[cell]] += static_cast<double>(constraints[c].mines) / static_cast<double>(constraints[c].cells.size());
+					++numbers[local[cell]];
+				}
+			}
+
+			double expected = 0.0;
+			for (size_t cell = 0; cell < size; ++cell)
+				expected += estimate[cell] /= std::max(numbers[cell], 1);
+
+			const auto mines = std::min<size_t>(static_cast<size_t>(std::lround(expected)), size);
+			group.counts[mines] = 1.0;
+			for (size_t cell = 0; cell < size; ++cell)
+				group.cellCounts[cell * (size + 1) + mines] = estimate[cell];
+		}
+	}
+
+	// the mines off the frontier can be anywhere among the undecided cells no number touches, in C(interior, rest)
+	// ways for each total on the frontier
+	const qint64        interior = static_cast<qint64>(m_unknownCells) - static_cast<qint64>(cells.size());
+	std::vector<double> ways(cells.size() + 1, 0.0);
+	{
+		std::vector<double> logWays(cells.size() + 1, -INFINITY);
+		for (qint64 frontierMines = 0; frontierMines <= static_cast<qint64>(cells.size()); ++frontierMines)
+		{
+			const qint64 rest = remaining - frontierMines;
+			if (rest >= 0 && rest <= interior)
+				logWays[frontierMines] = logChoose(interior, rest);
+		}
+		const double largest = *std::max_element(logWays.begin(), logWays.end());
+		for (size_t total = 0; total < ways.size() && std::isfinite(largest); ++total)
+			ways[total] = std::isfinite(logWays[total]) ? std::exp(logWays[total] - largest) : 0.0;
+	}
+
+	// the weights of every other group together, from both ends, so each group can be left out in turn. That is
+	// quadratic in the frontier, past a point the groups are taken as if the mine count didn't tie them together.
+	const bool coupled = cells.size() <= MAX_FRONTIER_CELLS;
+	m_exact &= coupled;
+
+	std::vector<std::vector<double>> before(groups.size() + 1, std::vector<double>{1.0});
+	std::vector<std::vector<double>> after(groups.size() + 1, std::vector<double>{1.0});
+	if (coupled)
+	{
+		for (size_t g = 0; g < groups.size(); ++g)
+			before[g + 1] = convolve(before[g], groups[g].counts);
+		for (size_t g = groups.size(); g-- > 0;)
+			after[g] = convolve(after[g + 1], groups[g].counts);
+	}
+
+	double expectedOnFrontier = 0.0;
+	for (size_t g = 0; g < groups.size(); ++g)
+	{
+		const Group& group = groups[g];
+		const size_t size  = group.cells.size();
+
+		// the weight of each number of mines in this group, with everything else summed over
+		std::vector<double> weight(size + 1, coupled ? 0.0 : 1.0);
+		double              total = 0.0;
+		double              mean  = 0.0;
+		const auto          others = coupled ? convolve(before[g], after[g + 1]) : std::vector<double>{};
+		for (size_t mines = 0; mines <= size; ++mines)
+		{
+			for (size_t rest = 0; rest < others.size() && mines + rest < ways.size(); ++rest)
+				weight[mines] += others[rest] * ways[mines + rest];
+			total += group.counts[mines] * weight[mines];
+			mean += group.counts[mines] * weight[mines] * static_cast<double>(mines);
+		}
+		expectedOnFrontier += total > 0.0 ? mean / total : 0.0;
+
+		for (size_t cell = 0; cell < size; ++cell)
+		{
+			double mine = 0.0;
+			for (size_t mines = 0; mines <= size; ++mines)
+				mine += group.cellCounts[cell * (size + 1) + mines] * weight[mines];
+			m_frontier[cells[group.cells[cell]]] = total > 0.0 ? mine / total : 0.5;
+		}
+	}
+
+	m_interior = 0.0;
+	if (interior > 0 && !coupled)
+		m_interior = std::clamp((static_cast<double>(remaining) - expectedOnFrontier) / static_cast<double>(interior), 0.0, 1.0);
+	else if (interior > 0)
+	{
+		const std::vector<double>& all     = before.back();
+		double                     total   = 0.0;
+		double                     offEdge = 0.0;
+		for (size_t mines = 0; mines < all.size() && mines < ways.size(); ++mines)
+		{
+			total += all[mines] * ways[mines];
+			offEdge += all[mines] * ways[mines] * static_cast<double>(remaining - static_cast<qint64>(mines));
+		}
+		m_interior = total > 0.0 ? std::clamp(offEdge / total / static_cast<double>(interior), 0.0, 1.0) : 0.0;
+	}
+
+	// certainties found here are proofs, as long as nothing was estimated
+	if (m_exact)
+	{
+		for (const auto& [cell, probability] : m_frontier)
+		{
+			if (probability < CERTAIN)
+				decide(cell, Knowledge::Safe);
+			else if (probability > 1.0 - CERTAIN)
+				decide(cell, Knowledge::Mine);
+		}
+		propagate();
+	}
+
+	// what was decided agrees with the probabilities just found, so they still hold
+	m_enumerated = true;
+}
+
+//----------------------------
+//  INSTANTIATIONS
+//----------------------------
+
+template class BasicBoardSolver<RectangularTopology>;
+template class BasicBoardSolver<ToroidalTopology>;
+template class BasicBoardSolver<HexagonalTopology>;
+template class BasicBoardSolver<KnightTopology>;
\ No newline at end of file
@@ -0,0 +1,128 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       boardSolver.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `BoardSolver` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef BOARDSOLVER_H
+#define BOARDSOLVER_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "boardCore.h"
+
+#include <unordered_map>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: BoardSolver
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief What a player can know about a board from its revealed numbers, and how likely each other cell is a mine.
+/// @details The solver never looks at the mines or the flags, only at what is revealed and the mine count. It keeps
+///          what it has proven, a cell is safe or is a mine, and extends that incrementally: after a move only the
+///          numbers around the cells that changed are looked at again, with the rule that a number whose remaining
+///          mines are zero, or equal its undecided neighbors, decides all of them.
+///
+///          What that rule can't decide, `mineProbability()` settles by enumerating every arrangement of mines on the
+///          frontier that agrees with the numbers, one connected group of cells at a time, and weighting each by the
+///          ways the mines left over fit into the cells no number touches. A probability of exactly 0 or 1 is a proof
+///          as well and is kept. A group of more than `MAX_GROUP_CELLS` cells, or with more than `MAX_BRANCHES` partial
+///          arrangements to try, is estimated from its numbers instead, and `exact()` says so. So is the weighting by
+///          the mine count on a frontier of more than `MAX_FRONTIER_CELLS`, where each group is taken on its own.
+///
+///          The solver follows the neighbors of the core it is given, so it is instantiated on the same `Topology`.
+///          The solvers of the topologies in `topology.h` are instantiated in `boardSolver.cpp`.
+//----------------------------------------------------------------------------------------------------------------------
+template <class Topology>
+class BasicBoardSolver
+{
+public:
+
+	using Core  = BasicBoardCore<Topology>;
+	using Index = BoardCoreBase::Index;
+
+	enum class Knowledge : quint8
+	{
+		Unknown,
+		Safe,
+		Mine,
+	};
+
+	static constexpr quint32 MAX_GROUP_CELLS    = 256;
+	static constexpr quint64 MAX_BRANCHES       = 1 << 20; ///< per group of frontier cells
+	static constexpr quint32 MAX_FRONTIER_CELLS = 1024;
+
+public:
+
+	explicit BasicBoardSolver(const Core& core);
+
+	/// takes in a move, from the core's changed cells. Call it before they are cleared.
+	void update();
+
+	[[nodiscard]] Knowledge knowledge(Index cell) const noexcept { return m_knowledge[cell]; }
+	[[nodiscard]] quint32   knownMines() const noexcept { return m_knownMines; }
+
+	/// the chance `cell` is a mine, given everything revealed so far
+	[[nodiscard]] double mineProbability(Index cell);
+	[[nodiscard]] bool   exact() const noexcept { return m_exact; }
+
+private:
+
+	struct Constraint
+	{
+		std::vector<quint32> cells; ///< into the frontier
+		int                  mines = 0;
+	};
+
+	void reveal(Index cell);
+	void decide(Index cell, Knowledge knowledge);
+	void propagate();
+	void enumerate();
+
+private:
+
+	const Core&            m_core;
+	std::vector<Knowledge> m_knowledge;
+	std::vector<bool>      m_revealed; ///< the cells taken in as numbers
+	quint32                m_knownMines   = 0;
+	quint32                m_unknownCells = 0;
+
+	std::vector<Index> m_pending;     ///< revealed numbers to look at again
+	std::vector<Index> m_constraints; ///< revealed numbers that still have undecided neighbors
+
+	bool                              m_enumerated = false;
+	bool                              m_exact      = true;
+	std::unordered_map<Index, double> m_frontier; ///< mine probability of each frontier cell
+	double                            m_interior = 0.0; ///< mine probability of any other undecided cell
+};
+
+/// the solver of the classic board
+using BoardSolver = BasicBoardSolver<RectangularTopology>;
+
+#endif // BOARDSOLVER_H
\ No newline at end of file
@@ -0,0 +1,422 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       chunkedBoard.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `chunkedBoard.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "chunkedBoard.h"
+#include "splitMix64.h"
+#include "trace.h"
+
+#include <QDir>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <cstring>
+
+//----------------------------
+//  LOCAL DEFINITIONS
+//----------------------------
+
+namespace
+{
+	/// the view only ever shows a screenful, so past this the changes are better treated as "everything"
+	constexpr size_t MAX_CHANGED_CELLS = 1 << 16;
+
+	/// cells opened per call before a cascade yields, so an unlucky low-density cascade can't run away
+	constexpr size_t MAX_CASCADE_CELLS = 1 << 16;
+
+	/// chunks kept in memory before the least recently used ones are evicted, about 4 MB
+	constexpr size_t MAX_RESIDENT_CHUNKS = 1024;
+
+	constexpr int HALO_SIZE = ChunkedBoard::CHUNK_SIZE + 2;
+
+	/// a cache record: the chunk key, then one bit per cell for revealed and one for flagged
+	constexpr qint64 BITMAP_BYTES = ChunkedBoard::CHUNK_CELLS / 8;
+	constexpr qint64 RECORD_BYTES = sizeof(quint64) + 2 * BITMAP_BYTES;
+
+	int localIndex(QPoint cell) noexcept
+	{
+		return ((cell.y() & (ChunkedBoard::CHUNK_SIZE - 1)) << ChunkedBoard::CHUNK_SHIFT) | (cell.x() & (ChunkedBoard::CHUNK_SIZE - 1));
+	}
+} // namespace
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+ChunkedBoard::ChunkedBoard(double density)
+{
+	m_world.threshold = static_cast<quint64>(std::clamp(density, 0.0, 0.9) * 18446744073709551616.0);
+	m_cache.setFileTemplate(QDir::tempPath() + "/minesweeper-chunks-XXXXXX");
+}
+
+void ChunkedBoard::reset()
+{
+	// a new world. Chunks still being generated for the old one are recognized by their generation and dropped.
+	++m_world.generation;
+	m_state = State::Unstarted;
+
+	m_chunks.clear();
+	m_lastChunk = nullptr;
+	m_cacheIndex.clear();
+	if (m_cache.isOpen())
+		m_cache.resize(0);
+
+	m_floodStack.clear();
+	clearChanges();
+	m_flagCount     = 0;
+	m_revealedCount = 0;
+	m_detonatedCell = {};
+}
+
+void ChunkedBoard::start(QPoint firstClick, quint64 seed)
+{
+	m_world.seed   = seed;
+	m_world.origin = firstClick;
+	m_state        = State::InProgress;
+}
+
+bool ChunkedBoard::reveal(QPoint cell)
+{
+	TRACE_SCOPE("ChunkedBoard::reveal");
+
+	if (m_state != State::InProgress || (cellBits(cell) & (BoardCore::RevealedBit | BoardCore::FlaggedBit)))
+		return false;
+
+	if (isMine(cell))
+	{
+		detonate(cell);
+	}
+	else
+	{
+		open(cell);
+		flood();
+	}
+	return true;
+}
+
+bool ChunkedBoard::toggleFlag(QPoint cell)
+{
+	if (m_state != State::InProgress || isRevealed(cell))
+		return false;
+
+	auto& chunk = this->chunk(cell);
+	auto& bits  = chunk.cells[localIndex(cell)];
+	bits ^= BoardCore::FlaggedBit;
+	chunk.touched = true;
+	m_flagCount   = (bits & BoardCore::FlaggedBit) ? m_flagCount + 1 : m_flagCount - 1;
+	recordChange(cell);
+	return true;
+}
+
+bool ChunkedBoard::chord(QPoint cell)
+{
+	TRACE_SCOPE("ChunkedBoard::chord");
+
+	if (m_state != State::InProgress || !isRevealed(cell) || !adjacentMines(cell))
+		return false;
+
+	unsigned int flags = 0;
+	forEachNeighbor(cell, [&](QPoint neighbor) { flags += isFlagged(neighbor) ? 1 : 0; });
+	if (flags != adjacentMines(cell))
+		return false;
+
+	bool changed = false;
+	forEachNeighbor(cell,
+					[&](QPoint neighbor)
+					{
+						if (cellBits(neighbor) & (BoardCore::RevealedBit | BoardCore::FlaggedBit))
+							return;
+
+						if (isMine(neighbor))
+							detonate(neighbor);
+						else
+							open(neighbor);
+						changed = true;
+					});
+	flood();
+	return changed;
+}
+
+void ChunkedBoard::continueCascade()
+{
+	if (m_state == State::InProgress)
+		flood();
+}
+
+quint64 ChunkedBoard::memoryUsage() const noexcept
+{
+	return sizeof(*this) + m_chunks.size() * (sizeof(Chunk) + sizeof(std::shared_ptr<Chunk>) + 2 * sizeof(quint64)) +
+		   m_cacheIndex.size() * 2 * sizeof(quint64) + (m_floodStack.capacity() + m_changedCells.capacity()) * sizeof(QPoint);
+}
+
+quint8 ChunkedBoard::cellBits(QPoint cell)
+{
+	// before the first click there is no world yet, and every cell is simply unrevealed
+	if (m_state == State::Unstarted)
+		return 0;
+
+	return chunk(cell).cells[localIndex(cell)];
+}
+
+void ChunkedBoard::clearChanges() noexcept
+{
+	m_changedCells.clear();
+	m_changesOverflowed = false;
+}
+
+QFuture<ChunkedBoard::GeneratedChunk> ChunkedBoard::prefetch(const QRect& cells) const
+{
+	QList<quint64> missing;
+	if (m_state != State::Unstarted)
+	{
+		for (int y = cells.top() >> CHUNK_SHIFT; y <= cells.bottom() >> CHUNK_SHIFT; ++y)
+		{
+			for (int x = cells.left() >> CHUNK_SHIFT; x <= cells.right() >> CHUNK_SHIFT; ++x)
+			{
+				if (const quint64 key = chunkKey(QPoint(x << CHUNK_SHIFT, y << CHUNK_SHIFT)); !m_chunks.contains(key))
+					missing += key;
+			}
+		}
+	}
+
+	// generation only reads the world parameters, which are copied, so chunks are generated in parallel
+	return QtConcurrent::mapped(std::move(missing), [world = m_world](quint64 key) { return GeneratedChunk{world.generation, key, generate(world, key)}; });
+}
+
+void ChunkedBoard::install(const QList<GeneratedChunk>& chunks)
+{
+	for (const auto& generated : chunks)
+	{
+		// a cascade may have needed the chunk before the prefetch got to it, and the world may have been reset
+		if (generated.generation != m_world.generation || m_chunks.contains(generated.key))
+			continue;
+
+		restore(generated.key, *generated.chunk);
+		generated.chunk->lastUse = ++m_clock;
+		m_chunks.emplace(generated.key, generated.chunk);
+	}
+}
+
+void ChunkedBoard::evict(const QRect& keep)
+{
+	if (m_chunks.size() <= MAX_RESIDENT_CHUNKS)
+		return;
+
+	TRACE_SCOPE("ChunkedBoard::evict");
+
+	std::vector<std::pair<quint64, quint64>> candidates; // last use, key
+	for (const auto& [key, chunk] : m_chunks)
+	{
+		if (!chunkRect(key).intersects(keep))
+			candidates.emplace_back(chunk->lastUse, key);
+	}
+	std::sort(candidates.begin(), candidates.end());
+
+	// evict down to three quarters, so eviction doesn't run again on the very next scroll step
+	for (const auto& [lastUse, key] : candidates)
+	{
+		if (m_chunks.size() <= MAX_RESIDENT_CHUNKS * 3 / 4)
+			break;
+
+		// chunks without marks come back identical from their seed, only the player's marks need to be kept
+		const auto it = m_chunks.find(key);
+		if (it->second->touched && !store(key, *it->second))
+			continue;
+		m_chunks.erase(it);
+	}
+	m_lastChunk = nullptr;
+}
+
+quint64 ChunkedBoard::chunkKey(QPoint cell) noexcept
+{
+	return (static_cast<quint64>(static_cast<quint32>(cell.x() >> CHUNK_SHIFT)) << 32) | static_cast<quint32>(cell.y() >> CHUNK_SHIFT);
+}
+
+QRect ChunkedBoard::chunkRect(quint64 key) noexcept
+{
+	const auto x = static_cast<qint32>(static_cast<quint32>(key >> 32));
+	const auto y = static_cast<qint32>(static_cast<quint32>(key));
+	return QRect(x << CHUNK_SHIFT, y << CHUNK_SHIFT, CHUNK_SIZE, CHUNK_SIZE);
+}
+
+bool ChunkedBoard::isMine(const World& world, int column, int row) noexcept
+{
+	if (qAbs(column - world.origin.x()) <= 1 && qAbs(row - world.origin.y()) <= 1)
+		return false;
+
+	const quint64 position = (static_cast<quint64>(static_cast<quint32>(column)) << 32) | static_cast<quint32>(row);
+	return SplitMix64::mix(world.seed ^ SplitMix64::mix(position)) < world.threshold;
+}
+
+std::shared_ptr<ChunkedBoard::Chunk> ChunkedBoard::generate(const World& world, quint64 key)
+{
+	TRACE_SCOPE("ChunkedBoard::generate");
+
+	// the mines of the chunk plus a one cell border, which is all the adjacent counts need
+	const QRect                               rect = chunkRect(key);
+	std::array<quint8, HALO_SIZE * HALO_SIZE> halo;
+	for (int y = 0; y < HALO_SIZE; ++y)
+	{
+		for (int x = 0; x < HALO_SIZE; ++x)
+			halo[y * HALO_SIZE + x] = isMine(world, rect.left() + x - 1, rect.top() + y - 1) ? 1 : 0;
+	}
+
+	auto chunk = std::make_shared<Chunk>();
+	for (int y = 0; y < CHUNK_SIZE; ++y)
+	{
+		const quint8* above = &halo[y * HALO_SIZE];
+		const quint8* row   = above + HALO_SIZE;
+		const quint8* below = row + HALO_SIZE;
+		for (int x = 0; x < CHUNK_SIZE; ++x)
+		{
+			const int adjacent = above[x] + above[x + 1] + above[x + 2] + row[x] + row[x + 2] + below[x] + below[x + 1] + below[x + 2];
+			chunk->cells[(y << CHUNK_SHIFT) | x] = static_cast<quint8>(adjacent | (row[x + 1] ? BoardCore::MineBit : 0));
+		}
+	}
+	return chunk;
+}
+
+ChunkedBoard::Chunk& ChunkedBoard::chunk(QPoint cell)
+{
+	const quint64 key = chunkKey(cell);
+	if (m_lastChunk && key == m_lastKey)
+		return *m_lastChunk;
+
+	auto it = m_chunks.find(key);
+	if (it == m_chunks.end())
+	{
+		// not prefetched, so a cascade or the view needs it right now
+		auto generated = generate(m_world, key);
+		restore(key, *generated);
+		it = m_chunks.emplace(key, std::move(generated)).first;
+	}
+
+	it->second->lastUse = ++m_clock;
+	m_lastKey           = key;
+	m_lastChunk         = it->second.get();
+	return *m_lastChunk;
+}
+
+void ChunkedBoard::restore(quint64 key, Chunk& chunk)
+{
+	const auto record = m_cacheIndex.find(key);
+	if (record == m_cacheIndex.end() || !m_cache.seek(record->second + static_cast<qint64>(sizeof(quint64))))
+		return;
+
+	const QByteArray bitmaps = m_cache.read(2 * BITMAP_BYTES);
+	if (bitmaps.size() != 2 * BITMAP_BYTES)
+		return;
+
+	for (int i = 0; i < CHUNK_CELLS; ++i)
+	{
+		if (bitmaps[i >> 3] & (1 << (i & 7)))
+			chunk.cells[i] |= BoardCore::RevealedBit;
+		if (bitmaps[BITMAP_BYTES + (i >> 3)] & (1 << (i & 7)))
+			chunk.cells[i] |= BoardCore::FlaggedBit;
+	}
+	chunk.touched = true;
+}
+
+bool ChunkedBoard::store(quint64 key, const Chunk& chunk)
+{
+	if (!m_cache.isOpen() && !m_cache.open())
+		return false;
+
+	QByteArray record(RECORD_BYTES, '\0');
+	std::memcpy(record.data(), &key, sizeof(key));
+	char* revealed = record.data() + sizeof(quint64);
+	char* flagged  = revealed + BITMAP_BYTES;
+	for (int i = 0; i < CHUNK_CELLS; ++i)
+	{
+		if (chunk.cells[i] & BoardCore::RevealedBit)
+			revealed[i >> 3] |= static_cast<char>(1 << (i & 7));
+		if (chunk.cells[i] & BoardCore::FlaggedBit)
+			flagged[i >> 3] |= static_cast<char>(1 << (i & 7));
+	}
+
+	// records have a fixed size, so a chunk evicted again overwrites its old record in place
+	const auto   existing = m_cacheIndex.find(key);
+	const qint64 offset   = existing != m_cacheIndex.end() ? existing->second : m_cache.size();
+	if (!m_cache.seek(offset) || m_cache.write(record) != RECORD_BYTES)
+		return false;
+
+	m_cacheIndex[key] = offset;
+	return true;
+}
+
+void ChunkedBoard::open(QPoint cell)
+{
+	auto& chunk = this->chunk(cell);
+	auto& bits  = chunk.cells[localIndex(cell)];
+	bits |= BoardCore::RevealedBit;
+	chunk.touched = true;
+	++m_revealedCount;
+	recordChange(cell);
+
+	if (!(bits & BoardCore::AdjacentMask))
+		m_floodStack.push_back(cell);
+}
+
+void ChunkedBoard::flood()
+{
+	// same as `BoardCore::flood()`, except that the board has no edge to stop a cascade. Past the budget the cascade
+	// yields and the rest of it stays on the stack for `continueCascade()`.
+	for (size_t opened = 0; !m_floodStack.empty() && opened < MAX_CASCADE_CELLS; ++opened)
+	{
+		const QPoint cell = m_floodStack.back();
+		m_floodStack.pop_back();
+
+		forEachNeighbor(cell,
+						[this](QPoint neighbor)
+						{
+							if (!(cellBits(neighbor) & (BoardCore::RevealedBit | BoardCore::FlaggedBit)))
+								open(neighbor);
+						});
+	}
+}
+
+void ChunkedBoard::detonate(QPoint cell)
+{
+	auto& chunk = this->chunk(cell);
+	chunk.cells[localIndex(cell)] |= BoardCore::RevealedBit;
+	chunk.touched = true;
+	recordChange(cell);
+
+	if (m_state == State::InProgress)
+	{
+		m_state         = State::Defeat;
+		m_detonatedCell = cell;
+		m_floodStack.clear();
+	}
+}
+
+void ChunkedBoard::recordChange(QPoint cell)
+{
+	if (m_changesOverflowed)
+		return;
+
+	if (m_changedCells.size() < MAX_CHANGED_CELLS)
+	{
+		m_changedCells.push_back(cell);
+	}
+	else
+	{
+		m_changesOverflowed = true;
+		m_changedCells.clear();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       chunkedBoard.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `ChunkedBoard` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef CHUNKEDBOARD_H
+#define CHUNKEDBOARD_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "boardCore.h"
+
+#include <QFuture>
+#include <QPoint>
+#include <QRect>
+#include <QTemporaryFile>
+
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: ChunkedBoard
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief The rules of an endless game, on a board without edges.
+/// @details The plane is split into 64x64 chunks that are generated on demand. Whether a cell holds a mine is a hash
+///          of the seed and its coordinates, so a chunk can be generated on any thread, in any order, and always comes
+///          out the same. Only the player's marks make a chunk worth keeping: chunks that fall out of use are evicted,
+///          and the revealed and flagged bits of the ones the player touched go to a compact on-disk cache. Memory is
+///          therefore proportional to the area around the view, not to the area explored.
+///
+///          Cells are addressed by `QPoint(column, row)` and use the same bit layout as `BoardCore`.
+//----------------------------------------------------------------------------------------------------------------------
+class ChunkedBoard
+{
+public:
+
+	static constexpr int CHUNK_SHIFT = 6;
+	static constexpr int CHUNK_SIZE  = 1 << CHUNK_SHIFT;
+	static constexpr int CHUNK_CELLS = CHUNK_SIZE * CHUNK_SIZE;
+
+	using State = BoardCore::State;
+
+	struct Chunk
+	{
+		std::array<quint8, CHUNK_CELLS> cells{};
+		quint64                         lastUse = 0;
+		bool                            touched = false; ///< holds revealed or flagged cells
+	};
+
+	/// everything chunk generation depends on, copied into the worker threads
+	struct World
+	{
+		quint64 seed      = 0;
+		quint64 threshold = 0; ///< a cell is a mine when its hash is below this
+		QPoint  origin;        ///< the first click, which is always safe along with its neighbors
+		quint64 generation = 0;
+	};
+
+	struct GeneratedChunk
+	{
+		quint64                generation = 0;
+		quint64                key        = 0;
+		std::shared_ptr<Chunk> chunk;
+	};
+
+public:
+
+	explicit ChunkedBoard(double density);
+
+	void reset();
+	void start(QPoint firstClick, quint64 seed);
+
+	bool reveal(QPoint cell);
+	bool toggleFlag(QPoint cell);
+	bool chord(QPoint cell);
+
+	[[nodiscard]] bool hasPendingCascade() const noexcept { return !m_floodStack.empty(); }
+	void               continueCascade();
+
+	[[nodiscard]] State   state() const noexcept { return m_state; }
+	[[nodiscard]] quint64 seed() const noexcept { return m_world.seed; }
+	[[nodiscard]] quint64 flagCount() const noexcept { return m_flagCount; }
+	[[nodiscard]] quint64 revealedCount() const noexcept { return m_revealedCount; }
+	[[nodiscard]] QPoint  detonatedCell() const noexcept { return m_detonatedCell; }
+	[[nodiscard]] size_t  residentChunks() const noexcept { return m_chunks.size(); }
+	[[nodiscard]] quint64 memoryUsage() const noexcept;
+
+	[[nodiscard]] quint8       cellBits(QPoint cell);
+	[[nodiscard]] bool         isMine(QPoint cell) { return cellBits(cell) & BoardCore::MineBit; }
+	[[nodiscard]] bool         isRevealed(QPoint cell) { return cellBits(cell) & BoardCore::RevealedBit; }
+	[[nodiscard]] bool         isFlagged(QPoint cell) { return cellBits(cell) & BoardCore::FlaggedBit; }
+	[[nodiscard]] unsigned int adjacentMines(QPoint cell) { return cellBits(cell) & BoardCore::AdjacentMask; }
+
+	/// cells changed since the last call to `clearChanges()`, see `BoardCore::changedCells()`
+	[[nodiscard]] const std::vector<QPoint>& changedCells() const noexcept { return m_changedCells; }
+	[[nodiscard]] bool                       changesOverflowed() const noexcept { return m_changesOverflowed; }
+	void                                     clearChanges() noexcept;
+
+	/// generates the missing chunks under `cells` on the thread pool. Hand the results to `install()`.
+	[[nodiscard]] QFuture<GeneratedChunk> prefetch(const QRect& cells) const;
+	void                                  install(const QList<GeneratedChunk>& chunks);
+
+	/// drops the least recently used chunks outside `keep` once too many are resident
+	void evict(const QRect& keep);
+
+	template <class Function>
+	static void forEachNeighbor(QPoint cell, Function&& function)
+	{
+		for (int dy = -1; dy <= 1; ++dy)
+		{
+			for (int dx = -1; dx <= 1; ++dx)
+			{
+				if (dx || dy)
+					function(QPoint(cell.x() + dx, cell.y() + dy));
+			}
+		}
+	}
+
+private:
+
+	[[nodiscard]] static quint64 chunkKey(QPoint cell) noexcept;
+	[[nodiscard]] static QRect   chunkRect(quint64 key) noexcept;
+	[[nodiscard]] static bool    isMine(const World& world, int column, int row) noexcept;
+	[[nodiscard]] static std::shared_ptr<Chunk> generate(const World& world, quint64 key);
+
+	Chunk& chunk(QPoint cell);
+	void   restore(quint64 key, Chunk& chunk);
+	bool   store(quint64 key, const Chunk& chunk);
+
+	void open(QPoint cell);
+	void flood();
+	void detonate(QPoint cell);
+	void recordChange(QPoint cell);
+
+private:
+
+	World   m_world;
+	State   m_state = State::Unstarted;
+	quint64 m_clock = 0;
+
+	std::unordered_map<quint64, std::shared_ptr<Chunk>> m_chunks;
+	quint64                                             m_lastKey   = 0;       ///< one-entry cache in front of the map
+	Chunk*                                              m_lastChunk = nullptr;
+
+	// evicted player marks, one fixed-size record per chunk
+	QTemporaryFile                      m_cache;
+	std::unordered_map<quint64, qint64> m_cacheIndex;
+
+	std::vector<QPoint> m_floodStack;
+	std::vector<QPoint> m_changedCells;
+	bool                m_changesOverflowed = false;
+
+	quint64 m_flagCount     = 0;
+	quint64 m_revealedCount = 0;
+	QPoint  m_detonatedCell;
+};
+
+#endif // CHUNKEDBOARD_H
\ No newline at end of file
@@ -0,0 +1,77 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       customDifficultyDialog.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `customDifficultyDialog.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "customDifficultyDialog.h"
+
+#include <QFormLayout>
+
+#include <algorithm>
+#include <limits>
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+CustomDifficultyDialog::CustomDifficultyDialog(const BoardSize& initialSize, QWidget* parent)
+	: QDialog{parent}
+	, m_rows{new QSpinBox(this)}
+	, m_columns{new QSpinBox(this)}
+	, m_mines{new QSpinBox(this)}
+	, m_buttons{new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel, this)}
+{
+	this->setWindowTitle(tr("Custom Difficulty"));
+
+	m_rows->setRange(1, BoardSize::MAX_ROWS);
+	m_columns->setRange(1, BoardSize::MAX_COLUMNS);
+	m_rows->setValue(static_cast<int>(initialSize.rows));
+	m_columns->setValue(static_cast<int>(initialSize.columns));
+	updateMineLimit();
+	m_mines->setValue(static_cast<int>(initialSize.mines));
+
+	for (auto* spinBox : {m_rows, m_columns, m_mines})
+	{
+		spinBox->setGroupSeparatorShown(true);
+		spinBox->setAlignment(Qt::AlignRight);
+	}
+
+	connect(m_rows, &QSpinBox::valueChanged, this, &CustomDifficultyDialog::updateMineLimit);
+	connect(m_columns, &QSpinBox::valueChanged, this, &CustomDifficultyDialog::updateMineLimit);
+	connect(m_buttons, &QDialogButtonBox::accepted, this, &QDialog::accept);
+	connect(m_buttons, &QDialogButtonBox::rejected, this, &QDialog::reject);
+
+	auto* layout = new QFormLayout(this);
+	layout->addRow(tr("Rows:"), m_rows);
+	layout->addRow(tr("Columns:"), m_columns);
+	layout->addRow(tr("Mines:"), m_mines);
+	layout->addRow(m_buttons);
+	layout->setSizeConstraint(QLayout::SetFixedSize);
+}
+
+BoardSize CustomDifficultyDialog::boardSize() const
+{
+	return {static_cast<quint32>(m_rows->value()), static_cast<quint32>(m_columns->value()), static_cast<quint32>(m_mines->value())};
+}
+
+void CustomDifficultyDialog::updateMineLimit()
+{
+	// the first click is always safe, so at least one cell has to stay clear. QSpinBox is limited to int, which a
+	// full size board exceeds.
+	const quint64 cells = static_cast<quint64>(m_rows->value()) * static_cast<quint64>(m_columns->value());
+	m_mines->setRange(0, static_cast<int>(std::min<quint64>(cells - 1, std::numeric_limits<int>::max())));
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       customDifficultyDialog.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `CustomDifficultyDialog` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef CUSTOMDIFFICULTYDIALOG_H
+#define CUSTOMDIFFICULTYDIALOG_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "boardSize.h"
+
+#include <QDialog>
+#include <QDialogButtonBox>
+#include <QSpinBox>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: CustomDifficultyDialog
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Asks for the rows, columns and mines of a custom board.
+//----------------------------------------------------------------------------------------------------------------------
+class CustomDifficultyDialog : public QDialog
+{
+	Q_OBJECT
+public:
+
+	explicit CustomDifficultyDialog(const BoardSize& initialSize, QWidget* parent = nullptr);
+
+	[[nodiscard]] BoardSize boardSize() const;
+
+private:
+
+	void updateMineLimit();
+
+private:
+
+	QSpinBox*         m_rows;
+	QSpinBox*         m_columns;
+	QSpinBox*         m_mines;
+	QDialogButtonBox* m_buttons;
+};
+
+#endif // CUSTOMDIFFICULTYDIALOG_H
\ No newline at end of file
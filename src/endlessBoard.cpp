@@ -0,0 +1,366 @@
+#include "endlessBoard.h"
+#include "frameScheduler.h"
+#include "trace.h"
+
+#include <utility>
+
+#include <QMouseEvent>
+#include <QRandomGenerator>
+#include <QScrollBar>
+#include <QSignalBlocker>
+#include <QStyle>
+
+namespace
+{
+	/// share of mines, a little denser than expert
+	constexpr double MINE_DENSITY = 0.2;
+
+	/// how far the scroll bars reach from the first click, in cells. The board itself has no edge.
+	constexpr int SCROLL_RANGE = 1 << 20;
+
+	/// the cells in view plus a chunk on every side, which is kept resident and generated ahead of scrolling
+	QRect withMargin(const QRect& cells)
+	{
+		return cells.adjusted(-ChunkedBoard::CHUNK_SIZE, -ChunkedBoard::CHUNK_SIZE, ChunkedBoard::CHUNK_SIZE, ChunkedBoard::CHUNK_SIZE);
+	}
+} // namespace
+
+EndlessBoard::EndlessBoard(QWidget* parent /*= nullptr*/)
+	: QAbstractScrollArea(parent)
+	, m_core(MINE_DENSITY)
+	, m_gameContext(new QObject(this))
+{
+	TRACE_SCOPE("EndlessBoard::EndlessBoard");
+
+	this->setFrameShape(QFrame::NoFrame);
+	this->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
+	setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
+	setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
+
+	for (int slot = 0; slot < VISIBLE_ROWS * VISIBLE_COLUMNS; ++slot)
+	{
+		auto* tile = new Tile({0, 0}, viewport());
+		tile->setGeometry((slot % VISIBLE_COLUMNS) * Tile::SIZE, (slot / VISIBLE_COLUMNS) * Tile::SIZE, Tile::SIZE, Tile::SIZE);
+		m_tiles += tile;
+	}
+
+	// scroll bars count whole cells and start out centered, so the first click can be anywhere
+	{
+		const QSignalBlocker verticalBlocker(verticalScrollBar());
+		const QSignalBlocker horizontalBlocker(horizontalScrollBar());
+		verticalScrollBar()->setRange(-SCROLL_RANGE, SCROLL_RANGE);
+		verticalScrollBar()->setPageStep(VISIBLE_ROWS);
+		horizontalScrollBar()->setRange(-SCROLL_RANGE, SCROLL_RANGE);
+		horizontalScrollBar()->setPageStep(VISIBLE_COLUMNS);
+	}
+
+	const int scrollBarExtent = style()->pixelMetric(QStyle::PM_ScrollBarExtent, nullptr, this);
+	this->setFixedSize(VISIBLE_COLUMNS * Tile::SIZE + 2 * frameWidth() + scrollBarExtent, VISIBLE_ROWS * Tile::SIZE + 2 * frameWidth() + scrollBarExtent);
+
+	connect(&m_prefetchWatcher, &QFutureWatcher<ChunkedBoard::GeneratedChunk>::finished, this, &EndlessBoard::installPrefetched);
+
+	reset();
+}
+
+void EndlessBoard::reset()
+{
+	TRACE_SCOPE("EndlessBoard::reset");
+
+	// cancel anything the previous game still had scheduled. A prefetch still running belongs to the old world, and
+	// `ChunkedBoard::install()` drops it.
+	delete m_gameContext;
+	m_gameContext = new QObject(this);
+
+	m_defeat           = false;
+	m_exploded         = false;
+	m_minesShown       = false;
+	m_pressedButtons   = Qt::NoButton;
+	m_pressedCell      = std::nullopt;
+	m_reportedFlags    = 0;
+	m_reportedRevealed = 0;
+	m_previewedCells.clear();
+
+	m_core.reset();
+	m_clock.reset();
+
+	{
+		const QSignalBlocker verticalBlocker(verticalScrollBar());
+		const QSignalBlocker horizontalBlocker(horizontalScrollBar());
+		verticalScrollBar()->setValue(0);
+		horizontalScrollBar()->setValue(0);
+	}
+	m_firstCell = {0, 0};
+	bindTiles();
+}
+
+void EndlessBoard::mousePressEvent(QMouseEvent* event)
+{
+	if (m_defeat)
+		return;
+
+	m_pressedButtons = event->buttons();
+	m_pressedCell    = cellAt(event->position().toPoint());
+	m_pressResolved  = false;
+
+	if (m_core.state() == ChunkedBoard::State::Unstarted && m_pressedCell)
+	{
+		m_core.start(*m_pressedCell, QRandomGenerator::global()->generate64());
+		m_clock.start();
+		prefetch();
+		emit initialized();
+	}
+
+	updatePreview();
+}
+
+void EndlessBoard::mouseMoveEvent(QMouseEvent* event)
+{
+	if (auto cell = cellAt(event->position().toPoint()); cell != m_pressedCell)
+	{
+		m_pressedCell = cell;
+		updatePreview();
+	}
+}
+
+void EndlessBoard::mouseReleaseEvent(QMouseEvent* event)
+{
+	if (!m_pressResolved && m_pressedCell && !m_defeat)
+	{
+		if (m_pressedButtons == (Qt::LeftButton | Qt::RightButton))
+			m_core.chord(*m_pressedCell);
+		else if (m_pressedButtons == Qt::LeftButton)
+			m_core.reveal(*m_pressedCell);
+		else if (m_pressedButtons == Qt::RightButton)
+			m_core.toggleFlag(*m_pressedCell);
+
+		applyChanges();
+	}
+
+	m_pressResolved = true;
+	if (event->buttons() == Qt::NoButton)
+	{
+		m_pressedButtons = Qt::NoButton;
+		m_pressedCell    = std::nullopt;
+	}
+	updatePreview();
+}
+
+std::optional<QPoint> EndlessBoard::cellAt(QPoint position) const
+{
+	if (position.x() < 0 || position.y() < 0)
+		return std::nullopt;
+
+	const int r = position.y() / Tile::SIZE;
+	const int c = position.x() / Tile::SIZE;
+	if (r >= VISIBLE_ROWS || c >= VISIBLE_COLUMNS)
+		return std::nullopt;
+
+	return m_firstCell + QPoint(c, r);
+}
+
+Tile* EndlessBoard::tileFor(QPoint cell) const
+{
+	const QPoint offset = cell - m_firstCell;
+	if (offset.x() < 0 || offset.x() >= VISIBLE_COLUMNS || offset.y() < 0 || offset.y() >= VISIBLE_ROWS)
+		return nullptr;
+
+	return m_tiles[offset.y() * VISIBLE_COLUMNS + offset.x()];
+}
+
+QRect EndlessBoard::visibleCells() const
+{
+	return QRect(m_firstCell, QSize(VISIBLE_COLUMNS, VISIBLE_ROWS));
+}
+
+void EndlessBoard::updatePreview()
+{
+	QList<QPoint> previewed;
+	if (m_pressedCell && !m_pressResolved)
+	{
+		if (m_pressedButtons & Qt::LeftButton)
+			previewed += *m_pressedCell;
+		if (m_pressedButtons == (Qt::LeftButton | Qt::RightButton))
+			ChunkedBoard::forEachNeighbor(*m_pressedCell, [&previewed](QPoint neighbor) { previewed += neighbor; });
+	}
+
+	for (auto cell : std::as_const(m_previewedCells))
+	{
+		if (auto* tile = tileFor(cell); tile && !previewed.contains(cell))
+			tile->setPreviewed(false);
+	}
+	for (auto cell : std::as_const(previewed))
+	{
+		if (auto* tile = tileFor(cell); tile && !m_previewedCells.contains(cell))
+			tile->setPreviewed(true);
+	}
+	m_previewedCells = std::move(previewed);
+}
+
+void EndlessBoard::setPreviewed(const QList<QPoint>& cells, bool previewed)
+{
+	for (auto cell : cells)
+	{
+		if (auto* tile = tileFor(cell))
+			tile->setPreviewed(previewed);
+	}
+}
+
+void EndlessBoard::scrollContentsBy(int /*dx*/, int /*dy*/)
+{
+	const QPoint firstCell(horizontalScrollBar()->value(), verticalScrollBar()->value());
+	if (firstCell == m_firstCell)
+		return;
+
+	setPreviewed(m_previewedCells, false);
+	m_firstCell = firstCell;
+	bindTiles();
+	setPreviewed(m_previewedCells, true);
+
+	prefetch();
+}
+
+void EndlessBoard::applyChanges()
+{
+	TRACE_SCOPE("EndlessBoard::applyChanges");
+
+	// only the changes in view are drawn, everything else is picked up by `bindTiles()` when it scrolls into view
+	if (m_core.changesOverflowed())
+	{
+		bindTiles();
+	}
+	else
+	{
+		setUpdatesEnabled(false);
+		for (auto cell : m_core.changedCells())
+			updateTile(cell);
+		setUpdatesEnabled(true);
+	}
+	m_core.clearChanges();
+
+	BoardChanges changes;
+	changes.flagDelta     = static_cast<int>(m_core.flagCount() - m_reportedFlags);
+	changes.revealedDelta = static_cast<int>(m_core.revealedCount() - m_reportedRevealed);
+	m_reportedFlags       = m_core.flagCount();
+	m_reportedRevealed    = m_core.revealedCount();
+	if (!changes.isEmpty())
+		emit changed(changes);
+
+	if (!m_defeat && m_core.state() == ChunkedBoard::State::Defeat)
+	{
+		m_clock.stop();
+		defeatAnimation();
+	}
+
+	// a cascade that ran out of budget picks up again on the next event loop turn, so the window stays responsive
+	// while it spreads
+	if (m_core.hasPendingCascade())
+	{
+		QMetaObject::invokeMethod(m_gameContext, [this]()
+		{
+			m_core.continueCascade();
+			applyChanges();
+		}, Qt::QueuedConnection);
+	}
+
+	m_core.evict(withMargin(visibleCells()));
+}
+
+void EndlessBoard::updateTile(QPoint cell)
+{
+	auto* tile = tileFor(cell);
+	if (!tile)
+		return;
+
+	const quint8 bits     = m_core.cellBits(cell);
+	const bool   mine     = bits & BoardCore::MineBit;
+	const bool   revealed = bits & BoardCore::RevealedBit;
+	const bool   flagged  = bits & BoardCore::FlaggedBit;
+
+	// an endless board can't reveal all of its mines, so after a defeat the view shows the ones that scroll by
+	if (m_minesShown && flagged && !mine)
+		tile->setState(Tile::WrongFlag);
+	else if (revealed || (m_minesShown && mine && !flagged))
+		tile->setState(mine ? Tile::Mine : Tile::Revealed, bits & BoardCore::AdjacentMask);
+	else
+		tile->setState(flagged ? Tile::Flagged : Tile::Unrevealed);
+
+	if (m_exploded && cell == m_core.detonatedCell())
+		tile->setIcon(Tile::explosionIcon());
+}
+
+void EndlessBoard::bindTiles()
+{
+	TRACE_SCOPE("EndlessBoard::bindTiles");
+
+	setUpdatesEnabled(false);
+	for (int r = 0; r < VISIBLE_ROWS; ++r)
+	{
+		for (int c = 0; c < VISIBLE_COLUMNS; ++c)
+		{
+			const QPoint cell = m_firstCell + QPoint(c, r);
+			m_tiles[r * VISIBLE_COLUMNS + c]->setLocation({static_cast<unsigned int>(cell.y()), static_cast<unsigned int>(cell.x())});
+			updateTile(cell);
+		}
+	}
+	setUpdatesEnabled(true);
+}
+
+void EndlessBoard::defeatAnimation()
+{
+	m_defeat = true;
+	emit defeat();
+
+	const QPoint detonatedCell = m_core.detonatedCell();
+	FrameScheduler::instance().animate(m_gameContext, [this, detonatedCell, stage = 0](qint64 elapsed) mutable
+	{
+		if (stage == 0 && elapsed >= 350)
+		{
+			m_exploded = true;
+			if (auto* tile = tileFor(detonatedCell))
+				tile->setIcon(Tile::explosionIcon());
+			++stage;
+		}
+		if (stage == 1 && elapsed >= 500)
+		{
+			m_minesShown = true;
+			bindTiles();
+			return false;
+		}
+		return true;
+	});
+}
+
+void EndlessBoard::prefetch()
+{
+	if (m_core.state() == ChunkedBoard::State::Unstarted)
+		return;
+
+	// one at a time. A view that moves on in the meantime is fetched once the running one has been installed.
+	if (m_prefetchWatcher.isRunning())
+	{
+		m_prefetchAgain = true;
+		return;
+	}
+
+	m_prefetchAgain = false;
+	m_prefetchWatcher.setFuture(m_core.prefetch(withMargin(visibleCells())));
+}
+
+void EndlessBoard::installPrefetched()
+{
+	TRACE_SCOPE("EndlessBoard::installPrefetched");
+
+	m_core.install(m_prefetchWatcher.future().results());
+	m_core.evict(withMargin(visibleCells()));
+
+	if (m_prefetchAgain)
+		prefetch();
+}
+
+void EndlessBoard::setTheme(Qt::ColorScheme colorScheme)
+{
+	for (auto* tile : std::as_const(m_tiles))
+	{
+		tile->setTheme(colorScheme);
+	}
+}
\ No newline at end of file
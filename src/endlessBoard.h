@@ -0,0 +1,89 @@
+#pragma once
+#include <QList>
+#include <QAbstractScrollArea>
+#include <QFutureWatcher>
+
+#include <optional>
+
+#include "boardChanges.h"
+#include "chunkedBoard.h"
+#include "gameClock.h"
+#include "tile.h"
+
+/// A view of an endless `ChunkedBoard`. The view has a fixed size and scrolls in every direction, re-binding its
+/// tiles to whichever cells are in view like `GameBoard` does. Chunks around the view are generated ahead of time on
+/// the thread pool, so scrolling rarely has to wait for one.
+class EndlessBoard : public QAbstractScrollArea
+{
+	Q_OBJECT
+
+public:
+
+	static constexpr int VISIBLE_ROWS    = 24;
+	static constexpr int VISIBLE_COLUMNS = 40;
+
+	explicit EndlessBoard(QWidget* parent = nullptr);
+
+	quint64 revealedCount() const { return m_core.revealedCount(); }
+
+	/// milliseconds from the first click, up to the defeat once there is one, see `GameBoard::elapsed()`
+	qint64 elapsed() const { return m_clock.elapsed(); }
+
+public slots:
+
+	void reset();
+	void setTheme(Qt::ColorScheme colorScheme);
+
+protected:
+
+	void mousePressEvent(QMouseEvent* event) override;
+	void mouseReleaseEvent(QMouseEvent* event) override;
+	void mouseMoveEvent(QMouseEvent* event) override;
+	void scrollContentsBy(int dx, int dy) override;
+
+signals:
+
+	void initialized();
+	void defeat();
+	void changed(const BoardChanges& changes);
+
+private:
+
+	void                  bindTiles();
+	Tile*                 tileFor(QPoint cell) const;
+	std::optional<QPoint> cellAt(QPoint position) const;
+	QRect                 visibleCells() const;
+
+	void updatePreview();
+	void setPreviewed(const QList<QPoint>& cells, bool previewed);
+	void applyChanges();
+	void updateTile(QPoint cell);
+	void defeatAnimation();
+	void prefetch();
+	void installPrefetched();
+
+private:
+
+	ChunkedBoard m_core;
+	GameClock    m_clock;
+	QList<Tile*> m_tiles;
+
+	QPoint   m_firstCell;   ///< cell shown in the top left corner
+	QObject* m_gameContext; ///< context of everything scheduled for the current game, replaced on reset
+
+	QFutureWatcher<ChunkedBoard::GeneratedChunk> m_prefetchWatcher;
+	bool                                         m_prefetchAgain = false; ///< the view moved while a prefetch ran
+
+	// mouse input state, see `GameBoard`
+	Qt::MouseButtons      m_pressedButtons = Qt::NoButton;
+	std::optional<QPoint> m_pressedCell;
+	bool                  m_pressResolved = false;
+	QList<QPoint>         m_previewedCells;
+
+	quint64 m_reportedFlags    = 0;
+	quint64 m_reportedRevealed = 0;
+
+	bool m_defeat     = false;
+	bool m_exploded   = false;
+	bool m_minesShown = false;
+};
\ No newline at end of file
@@ -0,0 +1,158 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       frameScheduler.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `frameScheduler.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "frameScheduler.h"
+#include "trace.h"
+
+#include <QCoreApplication>
+
+#include <algorithm>
+#include <utility>
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+FrameScheduler& FrameScheduler::instance()
+{
+	// parented to the application so the frame timer is torn down with the event loop
+	static auto* scheduler = new FrameScheduler(QCoreApplication::instance());
+	return *scheduler;
+}
+
+FrameScheduler::FrameScheduler(QObject* parent)
+	: QObject(parent)
+{
+	m_frameTimer.setTimerType(Qt::PreciseTimer);
+	m_frameTimer.setInterval(FRAME_INTERVAL_MS);
+	connect(&m_frameTimer, &QTimer::timeout, this, &FrameScheduler::advance);
+
+	// a task's timer may go off a little late, which lets the system line it up with other wakeups
+	m_taskTimer.setTimerType(Qt::CoarseTimer);
+	m_taskTimer.setSingleShot(true);
+	connect(&m_taskTimer, &QTimer::timeout, this,
+			[this]
+			{
+				TRACE_COUNTER("FrameScheduler idle wakeups", static_cast<qint64>(++m_idleWakeups));
+				runTasks();
+				updateTimers();
+			});
+
+	m_clock.start();
+}
+
+void FrameScheduler::animate(QObject* context, Animation animation)
+{
+	m_animations.append({context, now(), std::move(animation)});
+	updateTimers();
+}
+
+void FrameScheduler::schedule(QObject* context, qint64 delay, Task task)
+{
+	m_tasks.append({context, now() + std::max<qint64>(delay, 0), std::move(task)});
+	updateTimers();
+}
+
+void FrameScheduler::cancel(QObject* context)
+{
+	m_tasks.removeIf([context](const ScheduledTask& task) { return task.context == context; });
+	updateTimers();
+}
+
+void FrameScheduler::setSuspended(bool suspended)
+{
+	if (suspended == m_suspended)
+		return;
+
+	m_suspended = suspended;
+	if (suspended)
+		m_suspendedAt = m_clock.elapsed();
+	else
+		m_suspendedTime += m_clock.elapsed() - m_suspendedAt;
+	updateTimers();
+}
+
+qint64 FrameScheduler::now() const
+{
+	return (m_suspended ? m_suspendedAt : m_clock.elapsed()) - m_suspendedTime;
+}
+
+void FrameScheduler::advance()
+{
+	TRACE_COUNTER("FrameScheduler frame wakeups", static_cast<qint64>(++m_frameWakeups));
+
+	// animations may start other animations, so advance a detached list and merge anything new afterwards
+	const qint64 time    = now();
+	auto         running = std::exchange(m_animations, {});
+	running.removeIf(
+		[time](Entry& entry)
+		{
+			return !entry.context || !entry.animation(time - entry.started);
+		});
+	running.append(std::move(m_animations));
+	m_animations = std::move(running);
+
+	// the frame has woken the process anyway
+	runTasks();
+	updateTimers();
+}
+
+void FrameScheduler::runTasks()
+{
+	// tasks may schedule other tasks, which wait for the next wakeup
+	const qint64 time = now();
+	auto         due  = std::exchange(m_tasks, {});
+	due.removeIf(
+		[this, time](ScheduledTask& task)
+		{
+			if (!task.context)
+				return true;
+			if (task.due > time)
+			{
+				m_tasks.append(std::move(task));
+				return true;
+			}
+			return false;
+		});
+
+	for (auto& task : due)
+	{
+		if (task.context)
+			task.task();
+	}
+}
+
+void FrameScheduler::updateTimers()
+{
+	if (m_suspended || m_animations.isEmpty())
+		m_frameTimer.stop();
+	else if (!m_frameTimer.isActive())
+		m_frameTimer.start();
+
+	// tasks wait for the next frame if there is one, otherwise for the first of them and any others due soon after
+	if (m_suspended || m_frameTimer.isActive() || m_tasks.isEmpty())
+	{
+		m_taskTimer.stop();
+		return;
+	}
+
+	const auto first = std::min_element(m_tasks.cbegin(), m_tasks.cend(),
+										[](const ScheduledTask& lhs, const ScheduledTask& rhs) { return lhs.due < rhs.due; });
+	m_taskTimer.start(static_cast<int>(std::max<qint64>(first->due + TASK_SLACK_MS - now(), 0)));
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       frameScheduler.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `FrameScheduler` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef FRAMESCHEDULER_H
+#define FRAMESCHEDULER_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+
+#include <functional>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: FrameScheduler
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Drives all running animations from a single frame timer, and every other timed refresh from one more.
+/// @details Every animation is advanced once per frame with the time elapsed since it started, so all of the cells
+///          it touches are updated in the same event loop turn and painted together. An animation ends when its
+///          callback returns `false` or when its context object is destroyed, which ties it to e.g. the lifetime of
+///          a game. The frame timer only runs while there is something to animate.
+///
+///          Tasks run once, when they are due. They ride along with the frames while there are any, otherwise a single
+///          coarse timer wakes the process for all the tasks due within `TASK_SLACK_MS` of the first, never early.
+///          While the window is hidden nothing runs at all, and the time it spends hidden doesn't count towards the
+///          animations. The wakeups are counted, and recorded as trace counters.
+//----------------------------------------------------------------------------------------------------------------------
+class FrameScheduler : public QObject
+{
+	Q_OBJECT
+
+public:
+
+	/// @param elapsed milliseconds since the animation was started
+	/// @returns true if the animation should keep running
+	using Animation = std::function<bool(qint64 elapsed)>;
+	using Task      = std::function<void()>;
+
+	static constexpr int FRAME_INTERVAL_MS = 16;
+	static constexpr int TASK_SLACK_MS     = 50; ///< how late a task may run to share a wakeup with another
+
+public:
+
+	static FrameScheduler& instance();
+
+	void animate(QObject* context, Animation animation);
+
+	/// runs `task` once, `delay` milliseconds from now or as soon after as it shares a wakeup with something else
+	void schedule(QObject* context, qint64 delay, Task task);
+
+	/// drops the tasks of `context` that haven't run yet
+	void cancel(QObject* context);
+
+	/// holds every animation and task, without a single wakeup, until it is resumed
+	void setSuspended(bool suspended);
+	[[nodiscard]] bool isSuspended() const noexcept { return m_suspended; }
+
+	[[nodiscard]] quint64 frameWakeups() const noexcept { return m_frameWakeups; } ///< to advance the animations
+	[[nodiscard]] quint64 idleWakeups() const noexcept { return m_idleWakeups; }   ///< for tasks alone
+
+private:
+
+	explicit FrameScheduler(QObject* parent = nullptr);
+
+	qint64 now() const;
+	void   advance();
+	void   runTasks();
+	void   updateTimers();
+
+private:
+
+	struct Entry
+	{
+		QPointer<QObject> context;
+		qint64            started;
+		Animation         animation;
+	};
+
+	struct ScheduledTask
+	{
+		QPointer<QObject> context;
+		qint64            due;
+		Task              task;
+	};
+
+	QTimer               m_frameTimer;
+	QTimer               m_taskTimer;
+	QList<Entry>         m_animations;
+	QList<ScheduledTask> m_tasks;
+
+	QElapsedTimer m_clock;             ///< time of the scheduler, which stands still while it is suspended
+	qint64        m_suspendedTime = 0; ///< total time spent suspended
+	qint64        m_suspendedAt   = 0;
+	bool          m_suspended     = false;
+
+	quint64 m_frameWakeups = 0;
+	quint64 m_idleWakeups  = 0;
+};
+
+#endif // FRAMESCHEDULER_H
\ No newline at end of file
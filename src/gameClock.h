@@ -0,0 +1,91 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       gameClock.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `GameClock` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+#ifndef GAMECLOCK_H
+#define GAMECLOCK_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include <QElapsedTimer>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: GameClock
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief The time a game has taken, from the first click to the victory or the defeat.
+/// @details The board starts and stops the clock in the same call as the click that starts or decides the game, and
+///          every reading is taken from the monotonic clock, so the time is exact to the millisecond however late the
+///          display gets around to showing it.
+//----------------------------------------------------------------------------------------------------------------------
+class GameClock
+{
+public:
+
+	/// starts counting from `elapsed` milliseconds, the time a resumed game had already taken
+	void start(qint64 elapsed = 0) noexcept
+	{
+		m_offset  = elapsed;
+		m_running = true;
+		m_timer.start();
+	}
+
+	/// holds the time the clock reads now
+	void stop() noexcept
+	{
+		m_offset  = this->elapsed();
+		m_running = false;
+	}
+
+	/// goes on from the time it was stopped at
+	void resume() noexcept
+	{
+		if (!m_running)
+			start(m_offset);
+	}
+
+	void reset() noexcept
+	{
+		m_offset  = 0;
+		m_running = false;
+	}
+
+	[[nodiscard]] bool isRunning() const noexcept { return m_running; }
+
+	/// milliseconds of play
+	[[nodiscard]] qint64 elapsed() const noexcept { return m_running ? m_offset + m_timer.elapsed() : m_offset; }
+
+private:
+
+	QElapsedTimer m_timer;
+	qint64        m_offset  = 0; ///< time before the timer was started, all of it once the clock is stopped
+	bool          m_running = false;
+};
+
+#endif // GAMECLOCK_H
\ No newline at end of file
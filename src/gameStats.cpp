@@ -23,21 +23,26 @@
 //      MEMBER FUNCTIONS
 //======================================================================================================================\
 
-void GameStats::addStat(HighScore::Difficulty difficulty, GameType type, quint64 time)
+void GameStats::addStat(const BoardSize& size, GameType type, quint64 milliseconds, const BoardCore::Metrics& metrics)
 {
 	switch (type)
 	{
 	case Forfeit:
-		stats[difficulty].forfeits.insert(time);
+		stats[size].forfeits.insert(milliseconds);
 		break;
 	case Loss:
-		stats[difficulty].losses.insert(time);
+		stats[size].losses.insert(milliseconds);
 		break;
 	case Win:
-		stats[difficulty].wins.insert(time);
+		stats[size].wins.insert(milliseconds);
 		break;
 	}
-	stats[difficulty].gamesPlayed.insert(time);
+	stats[size].gamesPlayed.insert(milliseconds);
+
+	if (type == Win && milliseconds)
+		stats[size].threeBVPerSecond.insert(metrics.threeBVPerSecond(milliseconds / 1000.0));
+	if (metrics.clicks)
+		stats[size].efficiency.insert(metrics.efficiency());
 }
 
 QDataStream& operator<<(QDataStream& stream, const GameStats& stats)
@@ -45,7 +50,8 @@ QDataStream& operator<<(QDataStream& stream, const GameStats& stats)
 	stream << (quint64)stats.stats.size();
 	for (auto it = stats.stats.begin(); it != stats.stats.end(); ++it)
 	{
-		stream << it->first << it->second.wins << it->second.losses << it->second.forfeits << it->second.gamesPlayed;
+		stream << it->first << it->second.wins << it->second.losses << it->second.forfeits << it->second.gamesPlayed
+			   << it->second.threeBVPerSecond << it->second.efficiency;
 	}
 	return stream;
 }
@@ -62,41 +68,81 @@ QDataStream& operator>>(QDataStream& stream, GameStats& stats)
 
 	for (quint64 i = 0; i < size; ++i)
 	{
-		HighScore::Difficulty	 difficulty;
+		BoardSize				 boardSize;
 		GameStats::GameStatsData data;
 
 		// Attempt to read data. If any part fails, return to avoid corrupted data
-		stream >> difficulty;
+		stream >> boardSize;
 		if (stream.status() != QDataStream::Ok)
 			return stream;
 
-		stream >> data.wins >> data.losses >> data.forfeits >> data.gamesPlayed;
+		stream >> data.wins >> data.losses >> data.forfeits >> data.gamesPlayed >> data.threeBVPerSecond >> data.efficiency;
 		if (stream.status() != QDataStream::Ok)
 			return stream;
 
 		// Add the read data to the map
-		stats.stats[difficulty] = data;
+		stats.stats[boardSize] = data;
 	}
 
 	return stream;
 }
 
-quint64 GameStats::played(HighScore::Difficulty difficulty) noexcept { return this->stats[difficulty].gamesPlayed.count(); }
+QList<BoardSize> GameStats::boardSizes() const
+{
+	QList<BoardSize> sizes;
+	for (const auto& [size, data] : stats)
+		sizes += size;
+	return sizes;
+}
+
+void GameStats::importLegacy(QDataStream& stream)
+{
+	// statistics used to be kept per difficulty. The presets carry over, but the dimensions of the old custom games
+	// were never recorded, so those can't be attributed to a board size.
+	if (stream.status() != QDataStream::Ok)
+		return;
+
+	quint64 size;
+	stream >> size;
+
+	for (quint64 i = 0; i < size; ++i)
+	{
+		HighScore::Difficulty	 difficulty;
+		GameStats::GameStatsData data;
+
+		stream >> difficulty >> data.wins >> data.losses >> data.forfeits >> data.gamesPlayed;
+		if (stream.status() != QDataStream::Ok)
+			return;
+
+		data.wins *= 1000;
+		data.losses *= 1000;
+		data.forfeits *= 1000;
+		data.gamesPlayed *= 1000;
+		if (difficulty != HighScore::custom)
+			stats[BoardSize::preset(difficulty)] = data;
+	}
+}
+
+quint64 GameStats::played(const BoardSize& size) noexcept { return this->stats[size].gamesPlayed.count(); }
+
+quint64 GameStats::wins(const BoardSize& size) noexcept { return this->stats[size].wins.count(); }
+
+quint64 GameStats::losses(const BoardSize& size) noexcept { return this->stats[size].losses.count(); }
 
-quint64 GameStats::wins(HighScore::Difficulty difficulty) noexcept { return this->stats[difficulty].wins.count(); }
+quint64 GameStats::forfeits(const BoardSize& size) noexcept { return this->stats[size].forfeits.count(); }
 
-quint64 GameStats::losses(HighScore::Difficulty difficulty) noexcept { return this->stats[difficulty].losses.count(); }
+double GameStats::winRate(const BoardSize& size) noexcept { return 100.0 * (double)wins(size) / (double)played(size); }
 
-quint64 GameStats::forfeits(HighScore::Difficulty difficulty) noexcept { return this->stats[difficulty].forfeits.count(); }
+double GameStats::lossRate(const BoardSize& size) noexcept { return 100.0 * (double)losses(size) / (double)played(size); }
 
-double GameStats::winRate(HighScore::Difficulty difficulty) noexcept { return 100.0 * (double)wins(difficulty) / (double)played(difficulty); }
+double GameStats::forfeitRate(const BoardSize& size) noexcept { return 100.0 * (double)forfeits(size) / (double)played(size); }
 
-double GameStats::lossRate(HighScore::Difficulty difficulty) noexcept { return 100.0 * (double)losses(difficulty) / (double)played(difficulty); }
+double GameStats::averageTimeToWin(const BoardSize& size) noexcept { return this->stats[size].wins.mean() / 1000.0; }
 
-double GameStats::forfeitRate(HighScore::Difficulty difficulty) noexcept { return 100.0 * (double)forfeits(difficulty) / (double)played(difficulty); }
+double GameStats::averageTimeToLoss(const BoardSize& size) noexcept { return this->stats.at(size).losses.mean() / 1000.0; }
 
-quint64 GameStats::averageTimeToWin(HighScore::Difficulty difficulty) noexcept { return this->stats[difficulty].wins.mean(); }
+double GameStats::averageTimeToForfeit(const BoardSize& size) noexcept { return this->stats.at(size).forfeits.mean() / 1000.0; }
 
-quint64 GameStats::averageTimeToLoss(HighScore::Difficulty difficulty) noexcept { return this->stats.at(difficulty).losses.mean(); }
+double GameStats::averageThreeBVPerSecond(const BoardSize& size) noexcept { return this->stats[size].threeBVPerSecond.mean(); }
 
-quint64 GameStats::averageTimeToForfeit(HighScore::Difficulty difficulty) noexcept { return this->stats.at(difficulty).forfeits.mean(); }
\ No newline at end of file
+double GameStats::averageEfficiency(const BoardSize& size) noexcept { return this->stats[size].efficiency.mean(); }
\ No newline at end of file
@@ -35,9 +35,12 @@
 //  INCLUDES
 //----------------------------
 
+#include <boardCore.h>
+#include <boardSize.h>
 #include <highScore.h>
 #include <statistics.h>
 
+#include <QList>
 #include <QObject>
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -60,37 +63,46 @@ public:
 
 	struct GameStatsData
 	{
-		Statistics<quint64> wins;
+		Statistics<quint64> wins;        ///< of the times in milliseconds, as are the other games
 		Statistics<quint64> losses;
 		Statistics<quint64> forfeits;
 		Statistics<quint64> gamesPlayed;
+		Statistics<double>  threeBVPerSecond; ///< of the wins
+		Statistics<double>  efficiency;       ///< of every game with a click, in percent
 	};
 
 public:
 
 	GameStats() = default;
 
-	[[nodiscard]] quint64 played(HighScore::Difficulty difficulty) noexcept;
-	[[nodiscard]] quint64 wins(HighScore::Difficulty difficulty) noexcept;
-	[[nodiscard]] quint64 losses(HighScore::Difficulty difficulty) noexcept;
-	[[nodiscard]] quint64 forfeits(HighScore::Difficulty difficulty) noexcept;
-	[[nodiscard]] double winRate(HighScore::Difficulty difficulty) noexcept;
-	[[nodiscard]] double lossRate(HighScore::Difficulty difficulty) noexcept;
-	[[nodiscard]] double forfeitRate(HighScore::Difficulty difficulty) noexcept;
-	[[nodiscard]] quint64 averageTimeToWin(HighScore::Difficulty difficulty) noexcept;
-	[[nodiscard]] quint64 averageTimeToLoss(HighScore::Difficulty difficulty) noexcept;
-	[[nodiscard]] quint64 averageTimeToForfeit(HighScore::Difficulty difficulty) noexcept;
+	[[nodiscard]] quint64 played(const BoardSize& size) noexcept;
+	[[nodiscard]] quint64 wins(const BoardSize& size) noexcept;
+	[[nodiscard]] quint64 losses(const BoardSize& size) noexcept;
+	[[nodiscard]] quint64 forfeits(const BoardSize& size) noexcept;
+	[[nodiscard]] double winRate(const BoardSize& size) noexcept;
+	[[nodiscard]] double lossRate(const BoardSize& size) noexcept;
+	[[nodiscard]] double forfeitRate(const BoardSize& size) noexcept;
+	[[nodiscard]] double averageTimeToWin(const BoardSize& size) noexcept;     ///< in seconds
+	[[nodiscard]] double averageTimeToLoss(const BoardSize& size) noexcept;    ///< in seconds
+	[[nodiscard]] double averageTimeToForfeit(const BoardSize& size) noexcept; ///< in seconds
+	[[nodiscard]] double averageThreeBVPerSecond(const BoardSize& size) noexcept;
+	[[nodiscard]] double averageEfficiency(const BoardSize& size) noexcept;
 
 public slots:
 
-	void addStat(HighScore::Difficulty difficulty, GameStats::GameType type, quint64 time);
+	void addStat(const BoardSize& size, GameStats::GameType type, quint64 milliseconds, const BoardCore::Metrics& metrics = {});
+
+	[[nodiscard]] QList<BoardSize> boardSizes() const;
+
+	/// adds the statistics versions before board sizes kept per difficulty, in whole seconds, under `stats`
+	void importLegacy(QDataStream& stream);
 
 	friend QDataStream& operator<<(QDataStream& stream, const GameStats& stats);
 	friend QDataStream& operator>>(QDataStream& stream, GameStats& stats);
 
 private:
 
-	std::map<HighScore::Difficulty, GameStatsData> stats;
+	std::map<BoardSize, GameStatsData> stats;
 };
 
 #endif // GAMESTATS_H
\ No newline at end of file
@@ -18,7 +18,9 @@
 //----------------------------
 
 #include "gameStatsDialog.h"
+#include "trace.h"
 
+#include <QPushButton>
 #include <QSizePolicy>
 #include <QTabBar>
 
@@ -28,26 +30,33 @@
 //      MEMBER FUNCTIONS
 //======================================================================================================================
 
-GameStatsDialog::GameStatsDialog(GameStats stats, QWidget* parent)
+GameStatsDialog::GameStatsDialog(GameStats stats, const ReplayArchive& archive, QWidget* parent)
 	: QDialog{parent}
 	, m_stats{std::move(stats)}
 	, m_tabWidget{new QTabWidget(this)}
 {
-	m_tabWidget->addTab(new QFrame, "Beginner");
-	m_tabWidget->addTab(new QFrame, "Intermediate");
-	m_tabWidget->addTab(new QFrame, "Expert");
+	TRACE_SCOPE("GameStatsDialog::GameStatsDialog");
 
-	m_tabWidget->tabBar()->setUsesScrollButtons(false);
+	m_tabWidget->tabBar()->setUsesScrollButtons(true);
 
 	this->setLayout(new QVBoxLayout());
 	this->layout()->addWidget(m_tabWidget);
 	this->setWindowTitle("Statistics");
 	this->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
 
-	// For each difficulty
-	for (auto difficulty : {HighScore::beginner, HighScore::intermediate, HighScore::expert})
+	// the presets always get a tab, every custom board size that has been played gets one after them
+	QList<BoardSize> sizes{BoardSize::preset(HighScore::beginner), BoardSize::preset(HighScore::intermediate), BoardSize::preset(HighScore::expert)};
+	for (const auto& size : m_stats.boardSizes())
 	{
-		auto* tab = m_tabWidget->widget(difficulty);
+		if (size.difficulty() == HighScore::custom)
+			sizes += size;
+	}
+
+	// For each board size
+	for (const auto& size : std::as_const(sizes))
+	{
+		auto* tab = new QFrame;
+		m_tabWidget->addTab(tab, size.name());
 		tab->setLayout(new QGridLayout(this));
 
 		auto* tabLayout = dynamic_cast<QGridLayout*>(tab->layout());
@@ -55,39 +64,109 @@ GameStatsDialog::GameStatsDialog(GameStats stats, QWidget* parent)
 		// List all the stats
 		int row = 0;
 		tabLayout->addWidget(new QLabel("Games Played:", this), ++row, 0);
-		tabLayout->addWidget(new QLabel(QString::number(m_stats.played(difficulty)), this), row, 1, Qt::AlignRight);
+		tabLayout->addWidget(new QLabel(QString::number(m_stats.played(size)), this), row, 1, Qt::AlignRight);
 		tabLayout->addWidget(new QFrame(this), ++row, 0);
 		tabLayout->addWidget(new QLabel("Wins:", this), ++row, 0);
-		tabLayout->addWidget(new QLabel(QString::number(m_stats.wins(difficulty)), this), row, 1, Qt::AlignRight);
+		tabLayout->addWidget(new QLabel(QString::number(m_stats.wins(size)), this), row, 1, Qt::AlignRight);
 		tabLayout->addWidget(new QLabel("Win Rate:", this), ++row, 0);
-		tabLayout->addWidget(new QLabel(QString::number(m_stats.winRate(difficulty), 'f', 1), this), row, 1, Qt::AlignRight);
+		tabLayout->addWidget(new QLabel(QString::number(m_stats.winRate(size), 'f', 1), this), row, 1, Qt::AlignRight);
 		tabLayout->addWidget(new QLabel("%", this), row, 2);
 		tabLayout->addWidget(new QLabel("Avg. Time to Win:", this), ++row, 0);
-		tabLayout->addWidget(new QLabel(QString::number(m_stats.averageTimeToWin(difficulty)), this), row, 1, Qt::AlignRight);
+		tabLayout->addWidget(new QLabel(QString::number(m_stats.averageTimeToWin(size), 'f', 2), this), row, 1, Qt::AlignRight);
 		tabLayout->addWidget(new QLabel("seconds", this), row, 2);
 		tabLayout->addWidget(new QFrame(this), ++row, 0);
 		tabLayout->addWidget(new QLabel("Losses:", this), ++row, 0);
-		tabLayout->addWidget(new QLabel(QString::number(m_stats.losses(difficulty)), this), row, 1, Qt::AlignRight);
+		tabLayout->addWidget(new QLabel(QString::number(m_stats.losses(size)), this), row, 1, Qt::AlignRight);
 		tabLayout->addWidget(new QLabel("Loss Rate:", this), ++row, 0);
-		tabLayout->addWidget(new QLabel(QString::number(m_stats.lossRate(difficulty), 'f', 1), this), row, 1, Qt::AlignRight);
+		tabLayout->addWidget(new QLabel(QString::number(m_stats.lossRate(size), 'f', 1), this), row, 1, Qt::AlignRight);
 		tabLayout->addWidget(new QLabel("%", this), row, 2);
 		tabLayout->addWidget(new QLabel("Avg. Time to Loss:", this), ++row, 0);
-		tabLayout->addWidget(new QLabel(QString::number(m_stats.averageTimeToLoss(difficulty)), this), row, 1, Qt::AlignRight);
+		tabLayout->addWidget(new QLabel(QString::number(m_stats.averageTimeToLoss(size), 'f', 2), this), row, 1, Qt::AlignRight);
 		tabLayout->addWidget(new QLabel("seconds", this), row, 2);
 		tabLayout->addWidget(new QFrame(this), ++row, 0);
 		tabLayout->addWidget(new QLabel("Forfeits:", this), ++row, 0);
-		tabLayout->addWidget(new QLabel(QString::number(m_stats.forfeits(difficulty)), this), row, 1, Qt::AlignRight);
+		tabLayout->addWidget(new QLabel(QString::number(m_stats.forfeits(size)), this), row, 1, Qt::AlignRight);
 		tabLayout->addWidget(new QLabel("Forfeit Rate:", this), ++row, 0);
-		tabLayout->addWidget(new QLabel(QString::number(m_stats.forfeitRate(difficulty), 'f', 1), this), row, 1, Qt::AlignRight);
+		tabLayout->addWidget(new QLabel(QString::number(m_stats.forfeitRate(size), 'f', 1), this), row, 1, Qt::AlignRight);
 		tabLayout->addWidget(new QLabel("%", this), row, 2);
 		tabLayout->addWidget(new QLabel("Avg. Time to Forfeit:", this), ++row, 0);
-		tabLayout->addWidget(new QLabel(QString::number(m_stats.averageTimeToForfeit(difficulty)), this), row, 1, Qt::AlignRight);
+		tabLayout->addWidget(new QLabel(QString::number(m_stats.averageTimeToForfeit(size), 'f', 2), this), row, 1, Qt::AlignRight);
 		tabLayout->addWidget(new QLabel("seconds", this), row, 2);
+
+		// measures of how the games were played rather than how long they took, kept by the board during play
+		tabLayout->addWidget(new QFrame(this), ++row, 0);
+		tabLayout->addWidget(new QLabel("Avg. 3BV/s:", this), ++row, 0);
+		tabLayout->addWidget(new QLabel(QString::number(m_stats.averageThreeBVPerSecond(size), 'f', 2), this), row, 1, Qt::AlignRight);
+		tabLayout->addWidget(new QLabel("Efficiency:", this), ++row, 0);
+		tabLayout->addWidget(new QLabel(QString::number(m_stats.averageEfficiency(size), 'f', 1), this), row, 1, Qt::AlignRight);
+		tabLayout->addWidget(new QLabel("%", this), row, 2);
+
+		// and how the guesses went, which takes the solver over the replays
+		const QStringList analysisRows{"Guesses per Game:", "Guesses Survived:", "Avg. Time per Guess:", "Mistakes per Game:"};
+		const QStringList analysisUnits{"", "%", "seconds", ""};
+		tabLayout->addWidget(new QFrame(this), ++row, 0);
+		for (qsizetype index = 0; index < analysisRows.size(); ++index)
+		{
+			auto* value = new QLabel("...", this);
+			tabLayout->addWidget(new QLabel(analysisRows[index], this), ++row, 0);
+			tabLayout->addWidget(value, row, 1, Qt::AlignRight);
+			tabLayout->addWidget(new QLabel(analysisUnits[index], this), row, 2);
+			m_analysisLabels[size] += value;
+		}
+
+		// the most recent game of this size, straight from the replay archive
+		if (const qsizetype latest = archive.latest(size); latest >= 0)
+		{
+			auto* watch = new QPushButton(tr("Watch Last Game"), this);
+			tabLayout->addWidget(new QFrame(this), ++row, 0);
+			tabLayout->addWidget(watch, ++row, 0, 1, 3);
+			connect(watch, &QPushButton::clicked, this,
+					[this, &archive, latest]
+					{
+						m_selectedReplay = archive.replay(latest);
+						if (m_selectedReplay)
+							accept();
+					});
+		}
 	}
 
+	connect(&m_analysis, &QFutureWatcher<ReplayAnalyzer::Summaries>::finished, this, &GameStatsDialog::showAnalysis);
+	m_analysis.setFuture(ReplayAnalyzer::summarize(archive));
+
 	this->adjustSize();
 }
 
+GameStatsDialog::~GameStatsDialog()
+{
+	// the workers read the archive's mapping, which the next finished game moves
+	m_analysis.cancel();
+	m_analysis.waitForFinished();
+}
+
+void GameStatsDialog::showAnalysis()
+{
+	if (m_analysis.isCanceled())
+		return;
+
+	const ReplayAnalyzer::Summaries summaries = m_analysis.result();
+	for (auto it = m_analysisLabels.begin(); it != m_analysisLabels.end(); ++it)
+	{
+		const ReplayAnalyzer::Summary summary = summaries.value(it.key());
+		const QList<QLabel*>&         labels  = it.value();
+		if (!summary.games)
+		{
+			for (auto* label : labels)
+				label->setText("-");
+			continue;
+		}
+
+		labels[0]->setText(QString::number(summary.guessesPerGame(), 'f', 2));
+		labels[1]->setText(QString::number(summary.guessSuccessRate(), 'f', 1));
+		labels[2]->setText(QString::number(summary.timePerGuess(), 'f', 2));
+		labels[3]->setText(QString::number(summary.mistakesPerGame(), 'f', 2));
+	}
+}
+
 void GameStatsDialog::setActiveTab(const QString& activeTab) const
 {
 	for (int index = 0; index < m_tabWidget->count(); index++)
@@ -36,13 +36,18 @@
 //----------------------------
 
 #include "gameStats.h"
+#include "replayAnalyzer.h"
+#include "replayArchive.h"
 
 #include <QDialog>
+#include <QFutureWatcher>
 #include <QLabel>
 #include <QTabWidget>
 #include <QVBoxLayout>
 #include <QGroupBox>
 
+#include <optional>
+
 //----------------------------------------------------------------------------------------------------------------------
 //      CLASS: GameStatsDialog 
 //----------------------------------------------------------------------------------------------------------------------
@@ -53,14 +58,26 @@ class GameStatsDialog : public QDialog
 	Q_OBJECT
 public:
 
-	explicit GameStatsDialog(GameStats stats, QWidget *parent = nullptr);
+	explicit GameStatsDialog(GameStats stats, const ReplayArchive& archive, QWidget *parent = nullptr);
+	~GameStatsDialog() override;
 
 	void setActiveTab(const QString& activeTab) const;
 
+	/// the game the player chose to watch before closing the dialog, if any
+	[[nodiscard]] const std::optional<Replay>& selectedReplay() const { return m_selectedReplay; }
+
 private:
 
 	GameStats m_stats;
 	QTabWidget *m_tabWidget;
+
+	std::optional<Replay> m_selectedReplay;
+
+	/// the analysis of the recorded games runs while the dialog is open, and fills these in when it's done
+	QFutureWatcher<ReplayAnalyzer::Summaries> m_analysis;
+	QMap<BoardSize, QList<QLabel*>>           m_analysisLabels;
+
+	void showAnalysis();
 };
 
 #endif //GAMESTATSDIALOG_H
\ No newline at end of file
@@ -1,270 +1,681 @@
 #include "gameboard.h"
+#include "frameScheduler.h"
+#include "trace.h"
 
 #include <algorithm>
-#include <random>
+#include <utility>
 
-#include <QGridLayout>
-#include <QSet>
-#include <QTimer>
-#include <QFuture>
-#include <QtConcurrent>
+#include <QMouseEvent>
+#include <QRandomGenerator>
+#include <QScreen>
+#include <QScrollBar>
+#include <QSignalBlocker>
+#include <QStyle>
+
+namespace
+{
+	/// time between two mines of the end-of-game animation, shortened on boards with many mines so that the whole
+	/// animation never takes longer than MAX_MINE_ANIMATION_MS
+	constexpr qint64 MINE_ANIMATION_INTERVAL_MS = 25;
+	constexpr qint64 MAX_MINE_ANIMATION_MS      = 3000;
+
+	/// batches touching more cells than this are applied to the tiles with updates disabled
+	constexpr size_t BULK_UPDATE_CELLS = 64;
+
+	/// fraction of the screen a board may cover before it scrolls
+	constexpr int MAX_SCREEN_PERCENT = 75;
+} // namespace
 
 GameBoard::GameBoard(unsigned int numRows, unsigned int numCols, unsigned int numMines, QWidget* parent /*= nullptr*/)
 	: m_numRows(numRows)
 	, m_numCols(numCols)
 	, m_numMines(numMines)
-	, QFrame(parent)
-	, explosionTimer(new QTimer(this))
+	, m_core(numRows, numCols, numMines)
+	, QAbstractScrollArea(parent)
+	, m_gameContext(new QObject(this))
 {
-	setupLayout();
-	createTiles();
-	addNeighbors();
+	TRACE_SCOPE("GameBoard::GameBoard");
 
-	connect(this, &GameBoard::victory, [this]()
-	{
-		explosionTimer->setProperty("victory", true);
-	});
-	connect(this, &GameBoard::defeat, [this]()
+	this->setFrameShape(QFrame::NoFrame);
+	this->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
+	layoutTiles();
+	bindTiles();
+}
+
+void GameBoard::setDimensions(unsigned int numRows, unsigned int numCols, unsigned int numMines)
+{
+	TRACE_SCOPE("GameBoard::setDimensions");
+
+	// previews belong to the old layout of the pool
+	setPreviewed(m_previewedCells, false);
+	m_previewedCells.clear();
+
+	m_numRows = numRows;
+	m_numCols = numCols;
+	m_core.resize(numRows, numCols, numMines);
+
+	layoutTiles();
+	reset(numMines);
+}
+
+void GameBoard::reset(unsigned int numMines)
+{
+	TRACE_SCOPE("GameBoard::reset");
+
+	// cancel anything the previous game still had scheduled
+	delete m_gameContext;
+	m_gameContext = new QObject(this);
+
+	m_numMines         = numMines;
+	m_defeat           = false;
+	m_victory          = false;
+	m_replaying        = false;
+	m_pressedButtons   = Qt::NoButton;
+	m_pressedCell      = BoardCore::NoCell;
+	m_reportedFlags    = 0;
+	m_reportedRevealed = 0;
+	m_mineIcon         = {};
+	m_mineIconEnd      = 0;
+	m_exploded         = false;
+	setPreviewed(m_previewedCells, false);
+	m_previewedCells.clear();
+
+	// a game that is replaced before it is decided was given up
+	m_replay.finish(Replay::Result::Forfeit);
+	m_clock.reset();
+	m_core.reset(numMines);
+	m_core.setHistoryEnabled(m_practice);
+	bindTiles();
+
+	// clearing the previous game is not a change the new game should see
+	m_pendingChanges = {};
+}
+
+void GameBoard::mousePressEvent(QMouseEvent* event)
+{
+	if (m_victory || m_defeat || m_replaying)
+		return;
+
+	m_pressedButtons = event->buttons();
+	m_pressedCell    = cellAt(event->position().toPoint());
+	m_pressResolved  = false;
+
+	if (m_core.state() == BoardCore::State::Unstarted && m_pressedCell != BoardCore::NoCell)
+		placeMines(m_pressedCell);
+
+	m_replay.record(Replay::Action::Press, m_pressedCell);
+	updatePreview();
+}
+
+void GameBoard::mouseMoveEvent(QMouseEvent* event)
+{
+	if (m_replaying)
+		return;
+
+	// without mouse tracking this only arrives while a button is held
+	if (auto cell = cellAt(event->position().toPoint()); cell != m_pressedCell)
 	{
-		explosionTimer->setProperty("victory", false);
-	});
+		m_pressedCell = cell;
+		updatePreview();
+	}
+}
+
+void GameBoard::mouseReleaseEvent(QMouseEvent* event)
+{
+	if (m_replaying)
+		return;
 
-	connect(explosionTimer, &QTimer::timeout, [this]()
+	// when both buttons were down the first release resolves the chord and the second one is ignored
+	m_replay.record(Replay::Action::Release, m_pressedCell);
+	if (!m_pressResolved && m_pressedCell != BoardCore::NoCell && !m_victory && !m_defeat)
 	{
-		if (m_mines.isEmpty())
+		if (m_pressedButtons == (Qt::LeftButton | Qt::RightButton))
 		{
-			explosionTimer->stop();
-			return;
+			m_replay.record(Replay::Action::Chord, m_pressedCell);
+			m_core.chord(m_pressedCell);
 		}
-
-		Tile* mine = m_mines.values().front();
-		m_mines.remove(mine);
-
-		if (explosionTimer->property("victory").toBool())
-			mine->setIcon(Tile::tadaIcon());
-		else
+		else if (m_pressedButtons == Qt::LeftButton)
 		{
-			if (!m_correctFlags.contains(mine))
-				mine->setIcon(Tile::explosionIcon());
+			m_replay.record(Replay::Action::Reveal, m_pressedCell);
+			m_core.reveal(m_pressedCell);
 		}
-	});
+		else if (m_pressedButtons == Qt::RightButton)
+		{
+			m_replay.record(Replay::Action::Flag, m_pressedCell);
+			m_core.toggleFlag(m_pressedCell);
+		}
+
+		applyChanges();
+	}
+	m_replay.flush();
+
+	m_pressResolved = true;
+	if (event->buttons() == Qt::NoButton)
+	{
+		m_pressedButtons = Qt::NoButton;
+		m_pressedCell    = BoardCore::NoCell;
+	}
+	updatePreview();
 }
 
-void GameBoard::setupLayout()
+BoardCore::Index GameBoard::cellAt(QPoint position) const
 {
-	this->setAttribute(Qt::WA_LayoutUsesWidgetRect);
-	this->setSizePolicy(QSizePolicy::Minimum, QSizePolicy::Minimum);
-	auto layout = new QGridLayout;
+	// tiles are laid out edge to edge at a fixed size, so the cell under the pointer is plain integer math
+	if (position.x() < 0 || position.y() < 0)
+		return BoardCore::NoCell;
 
-	layout->setSpacing(0);
-	layout->setContentsMargins(0, 0, 0, 0);
-	layout->setSizeConstraint(QLayout::SetFixedSize);
+	const auto r = static_cast<unsigned int>(position.y() / Tile::SIZE);
+	const auto c = static_cast<unsigned int>(position.x() / Tile::SIZE);
+	if (r >= m_visibleRows || c >= m_visibleCols)
+		return BoardCore::NoCell;
 
-	this->setLayout(layout);
+	return m_core.index(m_firstRow + r, m_firstCol + c);
 }
 
-QList<QPair<unsigned int, unsigned int>> GameBoard::generateTileIndices(unsigned int rows, unsigned int columns)
+Tile* GameBoard::tileFor(BoardCore::Index cell) const
 {
-	QList<QPair<unsigned int, unsigned int>> indices;
+	const unsigned int r = m_core.row(cell);
+	const unsigned int c = m_core.column(cell);
+	if (r < m_firstRow || r >= m_firstRow + m_visibleRows || c < m_firstCol || c >= m_firstCol + m_visibleCols)
+		return nullptr;
 
-	auto generate = [&indices](unsigned int rMax, unsigned int cMax, unsigned int startR, unsigned int endR)
-	{
-		QList<QPair<unsigned int, unsigned int>> localIndices;
-		for (unsigned int r = startR; r < endR; ++r)
-		{
-			for (unsigned int c = 0; c < cMax; ++c)
-			{
-				localIndices.append(qMakePair(r, c));
-			}
-		}
-		return localIndices;
-	};
+	return m_tiles[(r - m_firstRow) * m_visibleCols + (c - m_firstCol)];
+}
 
-	unsigned int                                             threadCount = QThread::idealThreadCount();
-	QList<QFuture<QList<QPair<unsigned int, unsigned int>>>> futures;
-	unsigned int                                             rowsPerThread = rows / threadCount;
+void GameBoard::updatePreview()
+{
+	// a held left button previews the cell under the pointer, both buttons preview it and its neighbors
+	QList<BoardCore::Index> previewed;
+	if (m_pressedCell != BoardCore::NoCell && !m_pressResolved)
+	{
+		if (m_pressedButtons & Qt::LeftButton)
+			previewed += m_pressedCell;
+		if (m_pressedButtons == (Qt::LeftButton | Qt::RightButton))
+			m_core.forEachNeighbor(m_pressedCell, [&previewed](BoardCore::Index neighbor) { previewed += neighbor; });
+	}
 
-	for (unsigned int i = 0; i < threadCount; ++i)
+	// only touch the tiles whose highlight actually changes
+	for (auto cell : std::as_const(m_previewedCells))
 	{
-		unsigned int startR = i * rowsPerThread;
-		unsigned int endR   = (i == threadCount - 1) ? rows : startR + rowsPerThread;
-		futures.append(QtConcurrent::run(generate, rows, columns, startR, endR));
+		if (auto* tile = tileFor(cell); tile && !previewed.contains(cell))
+			tile->setPreviewed(false);
 	}
+	for (auto cell : std::as_const(previewed))
+	{
+		if (auto* tile = tileFor(cell); tile && !m_previewedCells.contains(cell))
+			tile->setPreviewed(true);
+	}
+	m_previewedCells = std::move(previewed);
+}
 
-	for (auto& future : futures)
+void GameBoard::setPreviewed(const QList<BoardCore::Index>& cells, bool previewed)
+{
+	for (auto cell : cells)
 	{
-		indices += future.result();
+		if (auto* tile = tileFor(cell))
+			tile->setPreviewed(previewed);
 	}
+}
 
-	return indices;
+void GameBoard::scrollContentsBy(int /*dx*/, int /*dy*/)
+{
+	// scrolling moves the window of cells, the tiles themselves stay put and are re-bound
+	const auto firstRow = static_cast<unsigned int>(verticalScrollBar()->value());
+	const auto firstCol = static_cast<unsigned int>(horizontalScrollBar()->value());
+	if (firstRow == m_firstRow && firstCol == m_firstCol)
+		return;
+
+	setPreviewed(m_previewedCells, false);
+	m_firstRow = firstRow;
+	m_firstCol = firstCol;
+	bindTiles();
+	setPreviewed(m_previewedCells, true);
 }
 
-void GameBoard::createTile(QPair<unsigned int, unsigned int> tileIndex)
+void GameBoard::applyChanges()
 {
-	auto r = tileIndex.first;
-	auto c = tileIndex.second;
+	TRACE_SCOPE("GameBoard::applyChanges");
 
-	// add a new tile to the row
-	m_tiles[r] += new Tile({r, c}, this);
-	static_cast<QGridLayout*>(this->layout())->addWidget(m_tiles[r][c], r, c);
-	connect(m_tiles[r][c], &Tile::firstClick, this, &GameBoard::placeMines);
-	connect(m_tiles[r][c], &Tile::flagged, [this, tile = m_tiles[r][c]](bool isMine)
+	// the core has already resolved the whole action, including any flood fill, so redraw the cells it touched in
+	// one pass. Large batches are applied with updates off, so the board repaints once instead of once per tile.
+	const bool bulk = m_core.changesOverflowed() || m_core.changedCells().size() > BULK_UPDATE_CELLS;
+	if (bulk)
+		setUpdatesEnabled(false);
+
+	if (m_core.changesOverflowed())
 	{
-		if (isMine)
-			m_correctFlags.insert(tile);
-		else
-			m_incorrectFlags.insert(tile);
-		checkVictory();
-	});
-	connect(m_tiles[r][c], &Tile::unFlagged, [this, tile = m_tiles[r][c]](bool isMine)
+		bindTiles();
+		m_pendingChanges.markDirty(0, 0);
+		m_pendingChanges.markDirty(m_numRows - 1, m_numCols - 1);
+	}
+	else
 	{
-		if (isMine)
-			m_correctFlags.remove(tile);
-		else
-			m_incorrectFlags.remove(tile);
-		checkVictory();
-	});
-	connect(m_tiles[r][c], &Tile::revealed, [this, tile = m_tiles[r][c]]()
+		for (auto cell : m_core.changedCells())
+		{
+			updateTile(cell);
+			m_pendingChanges.markDirty(m_core.row(cell), m_core.column(cell));
+		}
+	}
+
+	if (bulk)
+		setUpdatesEnabled(true);
+	m_core.clearChanges();
+
+	m_pendingChanges.flagDelta += static_cast<int>(m_core.flagCount()) - static_cast<int>(m_reportedFlags);
+	m_pendingChanges.revealedDelta += static_cast<int>(m_core.revealedCount()) - static_cast<int>(m_reportedRevealed);
+	m_reportedFlags    = m_core.flagCount();
+	m_reportedRevealed = m_core.revealedCount();
+
+	// the game is timed to the click that decided it, not to when its end is shown
+	if (!m_victory && m_core.state() == BoardCore::State::Victory)
 	{
-		m_revealedTiles.insert(tile);
-		checkVictory();
-	});
-	connect(m_tiles[r][c], &Tile::detonated, this, &GameBoard::defeatAnimation);
-	connect(this, &GameBoard::defeat, m_tiles[r][c], &Tile::disable);
-	connect(this, &GameBoard::victory, m_tiles[r][c], &Tile::disable);
+		m_clock.stop();
+		m_victory                = true;
+		m_pendingChanges.victory = true;
+		m_replay.finish(Replay::Result::Victory);
+	}
+	if (!m_defeat && m_core.state() == BoardCore::State::Defeat)
+	{
+		m_clock.stop();
+		m_replay.finish(Replay::Result::Defeat);
+		defeatAnimation();
+	}
+
+	scheduleFlush();
 }
 
-void GameBoard::createTiles()
+void GameBoard::updateTile(BoardCore::Index cell)
 {
-	m_tiles.resize(m_numRows);
-	m_tileIndices = generateTileIndices(m_numRows, m_numCols);
+	auto* tile = tileFor(cell);
+	if (!tile)
+		return;
+
+	if (m_core.isRevealed(cell) && m_core.isFlagged(cell))
+		tile->setState(Tile::WrongFlag);
+	else if (m_core.isRevealed(cell))
+		tile->setState(m_core.isMine(cell) ? Tile::Mine : Tile::Revealed, m_core.adjacentMines(cell));
+	else
+		tile->setState(m_core.isFlagged(cell) ? Tile::Flagged : Tile::Unrevealed);
+
+	// end-of-game icons that have already been animated onto this cell
+	if (m_core.isMine(cell) && cell < m_mineIconEnd && !(m_mineIconSkipsFlags && m_core.isFlagged(cell)))
+		tile->setIcon(m_mineIcon);
+	else if (m_exploded && cell == m_core.detonatedCell())
+		tile->setIcon(Tile::explosionIcon());
+}
+
+void GameBoard::layoutTiles()
+{
+	TRACE_SCOPE("GameBoard::layoutTiles");
+
+	// show as many cells as comfortably fit on the screen, the rest of a larger board is reached by scrolling
+	const QSize available = (screen() ? screen()->availableGeometry().size() : QSize(1024, 768)) * MAX_SCREEN_PERCENT / 100;
+	m_visibleRows         = std::min(m_numRows, static_cast<unsigned int>(std::max(1, available.height() / Tile::SIZE)));
+	m_visibleCols         = std::min(m_numCols, static_cast<unsigned int>(std::max(1, available.width() / Tile::SIZE)));
+	m_firstRow            = 0;
+	m_firstCol            = 0;
+
+	// the pool only grows when a view needs more tiles than any view before it, so restarting or switching back to
+	// a smaller difficulty reuses the tiles that already exist
+	const auto visibleCount = static_cast<qsizetype>(m_visibleRows) * m_visibleCols;
+	m_tiles.reserve(visibleCount);
+	while (m_tiles.size() < visibleCount)
+	{
+		m_tiles += new Tile({0, 0}, viewport());
+	}
+
+	// tiles are placed at fixed positions, the same arithmetic `cellAt()` uses to find them again
+	for (qsizetype slot = 0; slot < m_tiles.size(); ++slot)
+	{
+		auto* tile = m_tiles[slot];
+		if (slot < visibleCount)
+		{
+			const auto r = static_cast<int>(slot / m_visibleCols);
+			const auto c = static_cast<int>(slot % m_visibleCols);
+			tile->setGeometry(c * Tile::SIZE, r * Tile::SIZE, Tile::SIZE, Tile::SIZE);
+			tile->show();
+		}
+		else
+		{
+			tile->hide();
+		}
+	}
 
-	for (auto& tileIndex : m_tileIndices)
+	// scroll bars count whole cells. Their signals are held back until both ranges are valid for the new board.
 	{
-		createTile(tileIndex);
+		const QSignalBlocker verticalBlocker(verticalScrollBar());
+		const QSignalBlocker horizontalBlocker(horizontalScrollBar());
+		verticalScrollBar()->setRange(0, static_cast<int>(m_numRows - m_visibleRows));
+		verticalScrollBar()->setPageStep(static_cast<int>(m_visibleRows));
+		verticalScrollBar()->setValue(0);
+		horizontalScrollBar()->setRange(0, static_cast<int>(m_numCols - m_visibleCols));
+		horizontalScrollBar()->setPageStep(static_cast<int>(m_visibleCols));
+		horizontalScrollBar()->setValue(0);
 	}
 
-	m_tiles[0][0]->setDown(true);
+	const bool scrollsVertically   = m_numRows > m_visibleRows;
+	const bool scrollsHorizontally = m_numCols > m_visibleCols;
+	setVerticalScrollBarPolicy(scrollsVertically ? Qt::ScrollBarAlwaysOn : Qt::ScrollBarAlwaysOff);
+	setHorizontalScrollBarPolicy(scrollsHorizontally ? Qt::ScrollBarAlwaysOn : Qt::ScrollBarAlwaysOff);
+
+	const int scrollBarExtent = style()->pixelMetric(QStyle::PM_ScrollBarExtent, nullptr, this);
+	this->setFixedSize(static_cast<int>(m_visibleCols) * Tile::SIZE + 2 * frameWidth() + (scrollsVertically ? scrollBarExtent : 0),
+					   static_cast<int>(m_visibleRows) * Tile::SIZE + 2 * frameWidth() + (scrollsHorizontally ? scrollBarExtent : 0));
 }
 
-void GameBoard::addNeighbor(QPair<unsigned int, unsigned int> tileIndex)
-{
-	auto r = tileIndex.first;
-	auto c = tileIndex.second;
-
-	// add a new tile to the row
-	auto* tile    = m_tiles[r][c];
-	auto  lastRow = m_numRows - 1;
-	auto  lastCol = m_numCols - 1;
-
-	if (r && c)
-		tile->addNeighbor(m_tiles[r - 1][c - 1]); // top left
-	if (r)
-		tile->addNeighbor(m_tiles[r - 1][c]); // top
-	if (r && c < lastCol)
-		tile->addNeighbor(m_tiles[r - 1][c + 1]); // top right
-	if (c < lastCol)
-		tile->addNeighbor(m_tiles[r][c + 1]); // right
-	if (r < lastRow && c < lastCol)
-		tile->addNeighbor(m_tiles[r + 1][c + 1]); // bottom right
-	if (r < lastRow)
-		tile->addNeighbor(m_tiles[r + 1][c]); // bottom
-	if (r < lastRow && c)
-		tile->addNeighbor(m_tiles[r + 1][c - 1]); // bottom left
-	if (c)
-		tile->addNeighbor(m_tiles[r][c - 1]); // left
+void GameBoard::bindTiles()
+{
+	TRACE_SCOPE("GameBoard::bindTiles");
+
+	// re-bind every tile in view at once, with a single repaint at the end
+	setUpdatesEnabled(false);
+	for (unsigned int r = 0; r < m_visibleRows; ++r)
+	{
+		for (unsigned int c = 0; c < m_visibleCols; ++c)
+		{
+			const BoardCore::Index cell = m_core.index(m_firstRow + r, m_firstCol + c);
+			m_tiles[r * m_visibleCols + c]->setLocation({m_firstRow + r, m_firstCol + c});
+			updateTile(cell);
+		}
+	}
+	setUpdatesEnabled(true);
 }
 
-void GameBoard::addNeighbors()
+void GameBoard::scheduleFlush()
 {
-	QtConcurrent::blockingMap(m_tileIndices, [this](QPair<unsigned int, unsigned int> p) { this->addNeighbor(p); });
+	if (std::exchange(m_flushScheduled, true))
+		return;
+
+	QMetaObject::invokeMethod(this, &GameBoard::flushChanges, Qt::QueuedConnection);
 }
 
-void GameBoard::checkVictory()
+void GameBoard::flushChanges()
 {
-	// when victory is accomplished, there may be more than 1 tile that are unrevealed, so make sure
-	// to only run this code once
-	if (!m_victory)
+	TRACE_SCOPE("GameBoard::flushChanges");
+
+	m_flushScheduled = false;
+
+	const BoardChanges changes = std::exchange(m_pendingChanges, {});
+	if (changes.isEmpty())
+		return;
+
+	emit changed(changes);
+
+	if (changes.resumed)
+		emit resumed();
+	if (changes.victory)
 	{
-		emit flagCountChanged(m_correctFlags.size() + m_incorrectFlags.size());
-		if ((m_revealedTiles.size() == m_numCols * m_numRows - m_numMines) && m_incorrectFlags.isEmpty())
-		{
+		if (!m_replaying)
 			emit victory();
-			m_victory = true;
-			QTimer::singleShot(0, explosionTimer, [this]()
-			{
-				explosionTimer->start(25);
-			});
-		}
+		animateMines(Tile::tadaIcon(), false, MINE_ANIMATION_INTERVAL_MS);
 	}
+	if (changes.defeat && !m_replaying)
+		emit defeat();
 }
 
 void GameBoard::defeatAnimation()
 {
-	Tile* sender = dynamic_cast<Tile*>(this->sender());
-	QTimer::singleShot(350, this, [sender]()
-	{
-		sender->setIcon(Tile::explosionIcon());
-	});
-	QTimer::singleShot(500, this, [this]()
+	// only the first detonation counts
+	if (m_defeat)
+		return;
+	m_defeat = true;
+
+	const BoardCore::Index detonatedCell = m_core.detonatedCell();
+	FrameScheduler::instance().animate(m_gameContext, [this, detonatedCell, stage = 0](qint64 elapsed) mutable
 	{
-		for (auto wrong : m_incorrectFlags)
+		if (stage == 0 && elapsed >= 350)
 		{
-			wrong->setIcon(Tile::wrongIcon());
+			m_exploded = true;
+			if (auto* tile = tileFor(detonatedCell))
+				tile->setIcon(Tile::explosionIcon());
+			++stage;
 		}
-		for (auto mine : m_mines)
+		if (stage == 1 && elapsed >= 500)
 		{
-			disconnect(mine, &Tile::detonated, this, &GameBoard::defeatAnimation);
-			if (!mine->isFlagged())
-				mine->reveal();
+			// every mine and wrong flag is revealed in one core transition and drawn in one batch
+			m_core.revealMines();
+			m_pendingChanges.defeat = true;
+			applyChanges();
+
+			animateMines(Tile::explosionIcon(), true, 500);
+			return false;
 		}
-		emit defeat();
+		return true;
 	});
+}
 
-	QTimer::singleShot(1000, explosionTimer, [this]()
+void GameBoard::animateMines(const QIcon& icon, bool skipCorrectFlags, qint64 delay)
+{
+	if (!m_core.mines())
+		return;
+
+	m_mineIcon           = icon;
+	m_mineIconEnd        = 0;
+	m_mineIconSkipsFlags = skipCorrectFlags;
+
+	// the icons sweep across the board in cell order. Each frame moves the end of the range and sets the icon on the
+	// tiles in view that have come due since the last frame, so they are all painted together and nothing has to be
+	// collected up front, however many mines there are.
+	const qint64 duration = std::min<qint64>(m_core.mines() * MINE_ANIMATION_INTERVAL_MS, MAX_MINE_ANIMATION_MS);
+	FrameScheduler::instance().animate(m_gameContext, [this, duration, delay](qint64 elapsed)
 	{
-		explosionTimer->start(25);
+		if (elapsed < delay)
+			return true;
+
+		const qint64 cellCount = m_core.cellCount();
+		const auto   end       = static_cast<BoardCore::Index>(std::min<qint64>(cellCount, (elapsed - delay) * cellCount / duration + 1));
+		for (unsigned int r = 0; r < m_visibleRows; ++r)
+		{
+			for (unsigned int c = 0; c < m_visibleCols; ++c)
+			{
+				const BoardCore::Index cell = m_core.index(m_firstRow + r, m_firstCol + c);
+				if (cell >= m_mineIconEnd && cell < end && m_core.isMine(cell) && !(m_mineIconSkipsFlags && m_core.isFlagged(cell)))
+					m_tiles[r * m_visibleCols + c]->setIcon(m_mineIcon);
+			}
+		}
+		m_mineIconEnd = end;
+
+		return end < cellCount;
 	});
 }
 
-void GameBoard::placeMines(Tile* firstClicked)
+void GameBoard::placeMines(BoardCore::Index firstClicked)
+{
+	TRACE_SCOPE("GameBoard::placeMines");
+
+	m_core.placeMines(firstClicked, QRandomGenerator::global()->generate64());
+	m_numMines = m_core.mines();
+	m_clock.start();
+
+	// a game that can be taken back move by move has no replay that means anything
+	if (!practiceMode())
+		m_replay.start(m_core, firstClicked);
+
+	emit initialized();
+}
+
+std::optional<SavedGame> GameBoard::suspend()
+{
+	TRACE_SCOPE("GameBoard::suspend");
+
+	if (m_replaying || m_core.state() != BoardCore::State::InProgress)
+		return std::nullopt;
+
+	m_replay.suspend();
+	SavedGame game = SavedGame::capture(m_core);
+	game.elapsed   = static_cast<quint64>(m_clock.elapsed());
+	return game;
+}
+
+bool GameBoard::resume(const SavedGame& game)
 {
-	// get a flat list of tiles
-	QList<Tile*> tiles;
-	QSet<Tile*>  doneUse;
-	doneUse += firstClicked;
-	doneUse += QSet<Tile*>(firstClicked->neighbors().cbegin(), firstClicked->neighbors().cend());
+	TRACE_SCOPE("GameBoard::resume");
+
+	if (game.rows != m_numRows || game.columns != m_numCols)
+		return false;
 
-	for (unsigned int r = 0; r < m_numRows; ++r)
+	const unsigned int numMines = m_numMines;
+	reset(game.mines);
+	if (!game.restore(m_core))
 	{
-		m_tiles += QList<Tile*>{};
-		for (unsigned int c = 0; c < m_numCols; ++c)
-		{
-			// add a new tile to the row (unless it's the first one clicked)
-			if (auto tile = m_tiles[r][c]; !doneUse.contains(tile))
-				tiles += tile;
-		}
+		reset(numMines);
+		return false;
 	}
+	applyResumedGame(static_cast<qint64>(game.elapsed));
+	return true;
+}
 
-	// shuffle it
-	std::random_device rd;
-	std::mt19937       g(rd());
+bool GameBoard::resume(const Replay& replay)
+{
+	TRACE_SCOPE("GameBoard::resume");
 
-	std::shuffle(tiles.begin(), tiles.end(), g);
+	if (replay.rows != m_numRows || replay.columns != m_numCols || !replay.layout.empty())
+		return false;
 
-	for (unsigned int i = 0; i < m_numMines; ++i)
+	// the moves are made again all at once. A recorded game was never a practice game.
+	const unsigned int numMines = m_numMines;
+	reset(replay.mines);
+	m_core.setHistoryEnabled(false);
+	replay.placeMines(m_core);
+	for (const auto& event : replay.events)
 	{
-		tiles[i]->placeMine(true);
-		m_mines.insert(tiles[i]);
+		if (event.action != Replay::Action::Press && event.action != Replay::Action::Release)
+			applyReplayEvent(event);
+	}
+	if (m_core.state() != BoardCore::State::InProgress)
+	{
+		reset(numMines);
+		return false;
 	}
 
+	// the time of the last move is as far as the replay knows the game went
+	applyResumedGame(static_cast<qint64>(replay.duration / 1000));
+	return true;
+}
+
+void GameBoard::applyResumedGame(qint64 elapsed)
+{
+	// the replay of the game goes on where it stopped, if this is the game it was recording
+	m_numMines = m_core.mines();
+	m_replay.resume(m_core);
+	m_clock.start(elapsed);
+
+	// the core reports the whole board as changed, or every cell its moves changed, which redraws them and brings
+	// the counters up to date
 	emit initialized();
+	applyChanges();
+}
+
+void GameBoard::playReplay(const Replay& replay, int speed)
+{
+	TRACE_SCOPE("GameBoard::playReplay");
+
+	if (replay.rows == m_numRows && replay.columns == m_numCols)
+		reset(replay.mines);
+	else
+		setDimensions(replay.rows, replay.columns, replay.mines);
+
+	// the core places the same mines from the same seed and first click, the recorder stays out of it
+	m_replaying = true;
+	replay.placeMines(m_core);
+	m_numMines = m_core.mines();
+
+	// each frame plays every event that has come due since the last one and draws them together
+	const qint64 pace = std::clamp(speed, 1, MAX_REPLAY_SPEED);
+	FrameScheduler::instance().animate(m_gameContext, [this, events = replay.events, pace, next = size_t{0}](qint64 elapsed) mutable
+	{
+		const auto now   = static_cast<quint64>(elapsed * 1000 * pace);
+		const auto first = next;
+		while (next < events.size() && events[next].time <= now)
+			applyReplayEvent(events[next++]);
+
+		if (next != first)
+			applyChanges();
+		return next < events.size();
+	});
+}
+
+void GameBoard::applyReplayEvent(const Replay::Event& event)
+{
+	if (event.cell >= m_core.cellCount())
+		return;
+
+	switch (event.action)
+	{
+	case Replay::Action::Press:
+		setPreviewed(m_previewedCells, false);
+		m_previewedCells = {event.cell};
+		setPreviewed(m_previewedCells, true);
+		break;
+	case Replay::Action::Release:
+		setPreviewed(m_previewedCells, false);
+		m_previewedCells.clear();
+		break;
+	case Replay::Action::Reveal:
+		m_core.reveal(event.cell);
+		break;
+	case Replay::Action::Flag:
+		m_core.toggleFlag(event.cell);
+		break;
+	case Replay::Action::Chord:
+		m_core.chord(event.cell);
+		break;
+	default:
+		break;
+	}
+}
+
+void GameBoard::setPracticeMode(bool practice)
+{
+	m_practice = practice;
+	if (m_core.state() == BoardCore::State::Unstarted)
+		m_core.setHistoryEnabled(practice);
+}
+
+void GameBoard::undo()
+{
+	TRACE_SCOPE("GameBoard::undo");
+
+	if (m_replaying || !m_core.undo())
+		return;
+	applyHistoryStep();
+}
+
+void GameBoard::redo()
+{
+	TRACE_SCOPE("GameBoard::redo");
+
+	if (m_replaying || !m_core.redo())
+		return;
+	applyHistoryStep();
+}
+
+void GameBoard::applyHistoryStep()
+{
+	// taking back the end of the game takes back its animations as well. The icons they left are cleared by
+	// re-binding the tiles in view, the cells the step changed are redrawn like those of any other action.
+	if ((m_victory || m_defeat) && m_core.state() == BoardCore::State::InProgress)
+	{
+		delete m_gameContext;
+		m_gameContext = new QObject(this);
+
+		m_clock.resume();
+		m_victory     = false;
+		m_defeat      = false;
+		m_exploded    = false;
+		m_mineIcon    = {};
+		m_mineIconEnd = 0;
+		bindTiles();
+
+		m_pendingChanges.resumed = true;
+	}
+	applyChanges();
 }
 
 void GameBoard::setTheme(Qt::ColorScheme colorScheme)
 {
-	for(auto& index : m_tileIndices)
+	for (auto* tile : std::as_const(m_tiles))
 	{
-		m_tiles[index.first][index.second]->setTheme(colorScheme);
+		tile->setTheme(colorScheme);
 	}
 }
\ No newline at end of file
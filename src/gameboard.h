@@ -1,11 +1,20 @@
 #pragma once
 #include <QList>
-#include <QFrame>
-#include <QSet>
+#include <QAbstractScrollArea>
 
+#include "boardChanges.h"
+#include "boardCore.h"
+#include "gameClock.h"
+#include "replayRecorder.h"
+#include "savedGame.h"
 #include "tile.h"
 
-class GameBoard : public QFrame
+#include <optional>
+
+/// A view of the cells of a `BoardCore`. Boards that fit on the screen show every cell, larger ones scroll, and the
+/// same pool of tiles is re-bound to whichever cells are in view, so the number of widgets never depends on the size
+/// of the board.
+class GameBoard : public QAbstractScrollArea
 {
 	Q_OBJECT
 
@@ -17,31 +26,82 @@ public:
 	unsigned int numRows() const { return m_numRows; }
 	unsigned int numMines() const { return m_numMines; }
 
+	void setReplayArchive(ReplayArchive* archive) { m_replay.setArchive(archive); }
+
+	/// 3BV and clicks of the game so far
+	const BoardCore::Metrics& metrics() const { return m_core.metrics(); }
+
+	/// milliseconds from the first click, up to the click that decided the game once it is over
+	qint64 elapsed() const { return m_clock.elapsed(); }
+
+	/// practice games can be undone and redone step by step, and are not recorded. A game already under way stays
+	/// what it started as, the mode applies from the next one.
+	void setPracticeMode(bool practice);
+	bool practiceMode() const { return m_core.historyEnabled(); }
+	bool canUndo() const { return !m_replaying && m_core.canUndo(); }
+	bool canRedo() const { return !m_replaying && m_core.canRedo(); }
+
+	/// the game under way, to be continued later with `resume()`. Its replay is left unfinished, to be recorded on
+	/// once it is resumed. Nothing if no game is under way.
+	std::optional<SavedGame> suspend();
+
+	/// the game the last session left unfinished without putting it aside, a crash, as far as its replay goes
+	const std::optional<Replay>& interruptedGame() const { return m_replay.interrupted(); }
+
+	/// continues a suspended game of this board's dimensions, or an interrupted one from the moves in its replay, and
+	/// reports `initialized()` as a first click would
+	bool resume(const SavedGame& game);
+	bool resume(const Replay& replay);
+
+	static constexpr int MAX_REPLAY_SPEED = 64;
+
+	/// plays a recorded game back at `speed` times its original pace. Input is ignored until the next reset, and the
+	/// board doesn't report the start or the end of the game, so a replay never counts as a game played.
+	void playReplay(const Replay& replay, int speed);
+
 public slots:
 
-	void placeMines(Tile* firstClicked);
+	void placeMines(BoardCore::Index firstClicked);
+	void reset(unsigned int numMines);
+	void setDimensions(unsigned int numRows, unsigned int numCols, unsigned int numMines);
 	void setTheme(Qt::ColorScheme colorScheme);
+	void undo();
+	void redo();
+
+protected:
+
+	void mousePressEvent(QMouseEvent* event) override;
+	void mouseReleaseEvent(QMouseEvent* event) override;
+	void mouseMoveEvent(QMouseEvent* event) override;
+	void scrollContentsBy(int dx, int dy) override;
 
 signals:
 
 	void initialized();
 	void victory();
 	void defeat();
-	void flagCountChanged(unsigned int flagCount);
+	void changed(const BoardChanges& changes);
+	void resumed(); ///< an undo took back a victory or a defeat, the game goes on
 
 private:
 
-	QList<QPair<unsigned int, unsigned int>> generateTileIndices(unsigned int rows, unsigned int columns);
-
-	void createTile(QPair<unsigned int, unsigned int> tileIndex);
-	void createTiles();
+	void layoutTiles();
+	void bindTiles();
+	Tile* tileFor(BoardCore::Index cell) const;
 
 	void defeatAnimation();
-
-	void setupLayout();
-	void addNeighbor(QPair<unsigned int, unsigned int> tileIndex);
-	void addNeighbors();
-	void checkVictory();
+	BoardCore::Index cellAt(QPoint position) const;
+	void             updatePreview();
+	void             setPreviewed(const QList<BoardCore::Index>& cells, bool previewed);
+	void             applyChanges();
+	void             updateTile(BoardCore::Index cell);
+	void             animateMines(const QIcon& icon, bool skipCorrectFlags, qint64 delay);
+	void             applyReplayEvent(const Replay::Event& event);
+	void             applyHistoryStep();
+	void             applyResumedGame(qint64 elapsed);
+
+	void scheduleFlush();
+	void flushChanges();
 
 private:
 
@@ -49,16 +109,40 @@ private:
 	unsigned int m_numCols;
 	unsigned int m_numMines;
 
-	QList<QList<Tile*>>                      m_tiles;
-	QList<QPair<unsigned int, unsigned int>> m_tileIndices;
-
-	QSet<Tile*> m_mines;
-	QSet<Tile*> m_correctFlags;
-	QSet<Tile*> m_incorrectFlags;
-	QSet<Tile*> m_revealedTiles;
-
-	QTimer* explosionTimer;
-
-	bool m_defeat  = false;
-	bool m_victory = false;
+	BoardCore      m_core;
+	ReplayRecorder m_replay; ///< every game is recorded once there is an archive for it
+	GameClock      m_clock;
+	QList<Tile*>   m_tiles;  ///< pool of tile views, kept across games. The first `m_visibleRows * m_visibleCols` are in view.
+
+	// the window of cells currently in view
+	unsigned int m_firstRow    = 0;
+	unsigned int m_firstCol    = 0;
+	unsigned int m_visibleRows = 0;
+	unsigned int m_visibleCols = 0;
+
+	QObject* m_gameContext; ///< context of everything scheduled for the current game, replaced on reset
+
+	// mouse input state, shared by the whole board
+	Qt::MouseButtons        m_pressedButtons = Qt::NoButton;
+	BoardCore::Index        m_pressedCell    = BoardCore::NoCell; ///< cell under the pointer while a button is held
+	bool                    m_pressResolved  = false;             ///< the current press has already acted
+	QList<BoardCore::Index> m_previewedCells;
+
+	// end-of-game icons are kept as a range instead of per tile, so they survive scrolling. Mines below
+	// `m_mineIconEnd` show `m_mineIcon`.
+	QIcon            m_mineIcon;
+	BoardCore::Index m_mineIconEnd        = 0;
+	bool             m_mineIconSkipsFlags = false;
+	bool             m_exploded           = false;
+
+	BoardChanges m_pendingChanges;
+	bool         m_flushScheduled = false;
+
+	quint32 m_reportedFlags    = 0; ///< flag count of the core as of the last `applyChanges()`
+	quint32 m_reportedRevealed = 0; ///< revealed count of the core as of the last `applyChanges()`
+
+	bool m_defeat    = false;
+	bool m_victory   = false;
+	bool m_replaying = false; ///< showing a replay instead of a game
+	bool m_practice  = false; ///< for the next game, see `setPracticeMode()`
 };
\ No newline at end of file
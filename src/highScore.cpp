@@ -3,12 +3,15 @@
 #include <QDataStream>
 #include <QVariant>
 
-HighScore::HighScore(QString name, Difficulty difficulty, quint32 score, QDateTime date)
+HighScore::HighScore(QString name, Difficulty difficulty, quint32 milliseconds, QDateTime date, quint32 threeBV, quint32 clicks)
 	: QObject()
 	, m_name(name)
 	, m_difficulty(difficulty)
-	, m_score(score)
+	, m_score(milliseconds / 1000)
+	, m_milliseconds(milliseconds)
 	, m_date(date)
+	, m_threeBV(threeBV)
+	, m_clicks(clicks)
 {
 
 }
@@ -17,7 +20,10 @@ HighScore::HighScore(const HighScore& other)
 	: m_name(other.m_name)
 	, m_difficulty(other.m_difficulty)
 	, m_score(other.m_score)
+	, m_milliseconds(other.m_milliseconds)
 	, m_date(other.m_date)
+	, m_threeBV(other.m_threeBV)
+	, m_clicks(other.m_clicks)
 {
 
 }
@@ -27,7 +33,10 @@ HighScore& HighScore::operator=(const HighScore& other)
 	m_name = other.m_name;
 	m_difficulty = other.m_difficulty;
 	m_score = other.m_score;
+	m_milliseconds = other.m_milliseconds;
 	m_date = other.m_date;
+	m_threeBV = other.m_threeBV;
+	m_clicks = other.m_clicks;
 	return *this;
 }
 
@@ -46,14 +55,46 @@ quint32 HighScore::score() const
 	return m_score;
 }
 
+quint32 HighScore::time() const
+{
+	return isPrecise() ? m_milliseconds : m_score * 1000;
+}
+
+bool HighScore::isPrecise() const
+{
+	return m_milliseconds != 0;
+}
+
 QDateTime HighScore::date() const
 {
 	return m_date;
 }
 
+quint32 HighScore::threeBV() const
+{
+	return m_threeBV;
+}
+
+quint32 HighScore::clicks() const
+{
+	return m_clicks;
+}
+
+double HighScore::threeBVPerSecond() const
+{
+	// a score is only ever set for a victory, which solves the whole board
+	return time() ? 1000.0 * m_threeBV / time() : 0.0;
+}
+
+double HighScore::efficiency() const
+{
+	return m_clicks ? 100.0 * m_threeBV / m_clicks : 0.0;
+}
+
 bool HighScore::operator<(const HighScore& rhs) const
 {
-	return m_score < rhs.m_score;
+	// scores of the same second are ranked by their milliseconds
+	return time() < rhs.time();
 }
 
 void HighScore::setName(QString name)
@@ -71,11 +112,23 @@ void HighScore::setScore(quint32 score)
 	m_score = score;
 }
 
+void HighScore::setTime(quint32 milliseconds)
+{
+	m_score = milliseconds / 1000;
+	m_milliseconds = milliseconds;
+}
+
 void HighScore::setDate(QDateTime date)
 {
 	m_date = date;
 }
 
+void HighScore::setMetrics(quint32 threeBV, quint32 clicks)
+{
+	m_threeBV = threeBV;
+	m_clicks = clicks;
+}
+
 QDataStream& operator<<(QDataStream &out, const HighScore& highScore)
 {
 	out << highScore.name() << QVariant::fromValue(highScore.difficulty()).toString() << highScore.score() << highScore.date();
@@ -106,5 +159,6 @@ bool HighScore::operator==(const HighScore& rhs) const
 {
 	return (m_difficulty == rhs.m_difficulty &&
 			m_score == rhs.m_score &&
+			m_milliseconds == rhs.m_milliseconds &&
 			m_date == rhs.m_date);
 }
\ No newline at end of file
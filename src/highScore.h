@@ -64,25 +64,34 @@ public:
 		intermediate,
 		expert,
 		custom,
+		endless,
 	};
 	Q_ENUM(Difficulty);
 
 public:
 
 	HighScore() = default;
-	HighScore(QString name, Difficulty difficulty, quint32 score, QDateTime date);
+	HighScore(QString name, Difficulty difficulty, quint32 milliseconds, QDateTime date, quint32 threeBV = 0, quint32 clicks = 0);
 	HighScore(const HighScore& other);
 	HighScore& operator=(const HighScore& other);
 
 	[[nodiscard]] QString name() const;
 	[[nodiscard]] Difficulty difficulty() const;
-	[[nodiscard]] quint32 score() const;
+	[[nodiscard]] quint32 score() const;	///< whole seconds
+	[[nodiscard]] quint32 time() const;		///< milliseconds, the whole seconds of the score for one from before they were kept
+	[[nodiscard]] bool isPrecise() const;	///< the time is known to the millisecond
 	[[nodiscard]] QDateTime date() const;
+	[[nodiscard]] quint32 threeBV() const;
+	[[nodiscard]] quint32 clicks() const;
+	[[nodiscard]] double threeBVPerSecond() const;
+	[[nodiscard]] double efficiency() const;
 
 	void setName(QString name);
 	void setDifficultty(Difficulty difficulty);
 	void setScore(quint32 score);
+	void setTime(quint32 milliseconds);
 	void setDate(QDateTime date);
+	void setMetrics(quint32 threeBV, quint32 clicks);
 
 	bool operator<(const HighScore& rhs) const;
 	bool operator==(const HighScore& rhs) const;
@@ -94,7 +103,10 @@ private:
 	QString	m_name;
 	Difficulty	m_difficulty;
 	quint32	m_score;
+	quint32	m_milliseconds = 0;	///< 0 for scores from before they were timed to the millisecond
 	QDateTime m_date;
+	quint32	m_threeBV = 0;	///< of the board, 0 for scores from before it was recorded
+	quint32	m_clicks = 0;
 };
 
 Q_DECLARE_METATYPE(HighScore);
@@ -1,12 +1,16 @@
 #include "highScoreDialog.h"
+#include "trace.h"
 #include <QLayout>
 #include <QVBoxLayout>
 #include <QTableView>
 #include <QHeaderView>
 
-HighScoreDialog::HighScoreDialog(const QMap<HighScore::Difficulty, HighScoreModel>& models, QWidget* parent)
+HighScoreDialog::HighScoreDialog(const QMap<BoardSize, HighScoreModel>& models, const ReplayArchive& archive, QWidget* parent)
 	: QDialog(parent)
+	, m_archive(archive)
 {
+	TRACE_SCOPE("HighScoreDialog::HighScoreDialog");
+
 	this->setWindowTitle(tr("High Scores"));
 	this->setLayout(new QVBoxLayout);
 
@@ -17,12 +21,9 @@ HighScoreDialog::HighScoreDialog(const QMap<HighScore::Difficulty, HighScoreMode
 	int modelHeight = 0;
 	int scrollBarWidth = this->style()->pixelMetric(QStyle::PM_ScrollBarExtent) + 2;
 
-	QList<QTableView*> views;
-
 	for (const auto& model : models)
 	{
-		QString difficulty = QVariant::fromValue(model.difficulty()).toString();
-		QString tabName = difficulty[0].toUpper() + difficulty.mid(1).toLower();
+		QString tabName = model.boardSize().name();
 
 		auto page = new QWidget;
 		tabWidget->addTab(page, tabName);
@@ -39,26 +40,62 @@ HighScoreDialog::HighScoreDialog(const QMap<HighScore::Difficulty, HighScoreMode
 
 		view->horizontalHeader()->setStretchLastSection(true);
 		view->setShowGrid(false);
-		views.append(view);
+		view->setSelectionBehavior(QAbstractItemView::SelectRows);
+		view->setSelectionMode(QAbstractItemView::SingleSelection);
+		m_views.append(view);
 	}
 
-	for (const auto view : views)
+	for (const auto view : std::as_const(m_views))
 	{
 		modelWidth = qMax(modelWidth, view->horizontalHeader()->length() + view->verticalHeader()->width() + scrollBarWidth);
 		modelHeight = qMax(modelHeight, view->verticalHeader()->length() + view->horizontalHeader()->height() + 2);
 	}
 
-	for (const auto view : views)
+	for (const auto view : std::as_const(m_views))
 		view->setFixedSize(modelWidth, modelHeight);
 
+	// a high score can be watched when the archive holds the game it came from
+	m_watchButton = new QPushButton(tr("Watch Replay"), this);
+	m_watchButton->setEnabled(false);
+	this->layout()->addWidget(m_watchButton);
+
+	auto updateWatchButton = [this] { m_watchButton->setEnabled(selectedReplayIndex() >= 0); };
+	for (const auto view : std::as_const(m_views))
+		connect(view->selectionModel(), &QItemSelectionModel::selectionChanged, this, updateWatchButton);
+	connect(tabWidget, &QTabWidget::currentChanged, this, updateWatchButton);
+
+	connect(m_watchButton, &QPushButton::clicked, this,
+			[this]
+			{
+				m_selectedReplay = m_archive.replay(selectedReplayIndex());
+				if (m_selectedReplay)
+					accept();
+			});
+
 	this->layout()->setSizeConstraint(QLayout::SetFixedSize);
 }
 
-void HighScoreDialog::setActiveTab(const QString& difficulty)
+qsizetype HighScoreDialog::selectedReplayIndex() const
+{
+	const int tab = tabWidget->currentIndex();
+	if (tab < 0 || tab >= m_views.size())
+		return -1;
+
+	const auto* view  = m_views[tab];
+	const auto* model = static_cast<const HighScoreModel*>(view->model());
+	const auto  rows  = view->selectionModel()->selectedRows();
+	if (rows.isEmpty() || rows.first().row() >= model->highScores().size())
+		return -1;
+
+	const HighScore& score = model->highScores()[rows.first().row()];
+	return m_archive.findVictory(model->boardSize(), score.time(), score.date());
+}
+
+void HighScoreDialog::setActiveTab(const QString& tabName)
 {
 	for (int index = 0; index < tabWidget->count(); index++)
 	{
-		if (tabWidget->tabText(index) == difficulty)
+		if (tabWidget->tabText(index) == tabName)
 		{
 			tabWidget->setCurrentIndex(index);
 			return;
@@ -40,9 +40,14 @@
 //-------------------------
 
 #include <QDialog>
+#include <QPushButton>
 #include <QTabWidget>
+#include <QTableView>
+
+#include <optional>
 
 #include "highScoreModel.h" 
+#include "replayArchive.h"
 
 //-------------------------
 //	FORWARD DECLARATIONS
@@ -52,11 +57,23 @@ class HighScoreDialog : public QDialog
 {
 public:
 
-	explicit HighScoreDialog(const QMap<HighScore::Difficulty, HighScoreModel>& models, QWidget* parent = nullptr);
+	explicit HighScoreDialog(const QMap<BoardSize, HighScoreModel>& models, const ReplayArchive& archive, QWidget* parent = nullptr);
+
+	void setActiveTab(const QString& tabName);
+
+	/// the game behind the high score the dialog was closed with, if the player chose to watch one
+	[[nodiscard]] const std::optional<Replay>& selectedReplay() const { return m_selectedReplay; }
 
-	void setActiveTab(const QString& difficulty);
+private:
+
+	qsizetype selectedReplayIndex() const;
 
 private:
 
-	QTabWidget* tabWidget;
+	QTabWidget*          tabWidget;
+	QList<QTableView*>   m_views;
+	QPushButton*         m_watchButton;
+	const ReplayArchive& m_archive;
+
+	std::optional<Replay> m_selectedReplay;
 };
\ No newline at end of file
@@ -3,19 +3,22 @@
 
 constexpr int MAX_HIGH_SCORES = 10;
 
-HighScoreModel::HighScoreModel(HighScore::Difficulty difficulty, QObject* parent)
+HighScoreModel::HighScoreModel(const BoardSize& boardSize, QObject* parent)
 	: QAbstractItemModel(parent)
-	, m_difficulty(difficulty)
+	, m_difficulty(boardSize.difficulty())
+	, m_boardSize(boardSize)
 {
 }
 
 HighScoreModel::HighScoreModel(const HighScoreModel& other)
 	: m_difficulty(other.m_difficulty)
+	, m_boardSize(other.m_boardSize)
 	, m_highScores(other.m_highScores)
 {
 	beginInsertRows(QModelIndex(), 0, static_cast<int>(other.m_highScores.size()));
 	beginInsertColumns(QModelIndex(), 0, HighScoreModel::columnCount());
 	m_difficulty = other.m_difficulty;
+	m_boardSize  = other.m_boardSize;
 	m_highScores = other.m_highScores;
 	endInsertRows();
 	endInsertColumns();
@@ -29,6 +32,7 @@ HighScoreModel::HighScoreModel(HighScoreModel&& other) noexcept
 	beginInsertRows(QModelIndex(), 0, static_cast<int>(other.m_highScores.size()));
 	beginInsertColumns(QModelIndex(), 0, HighScoreModel::columnCount());
 	m_difficulty = other.m_difficulty;
+	m_boardSize  = other.m_boardSize;
 	m_highScores = std::move(other.m_highScores);
 	endInsertRows();
 	endInsertColumns();
@@ -39,6 +43,7 @@ HighScoreModel& HighScoreModel::operator=(HighScoreModel&& other) noexcept
 	beginInsertRows(QModelIndex(), 0, static_cast<int>(other.m_highScores.size()));
 	beginInsertColumns(QModelIndex(), 0, columnCount());
 	m_difficulty = other.m_difficulty;
+	m_boardSize  = other.m_boardSize;
 	m_highScores = std::move(other.m_highScores);
 	endInsertRows();
 	endInsertColumns();
@@ -50,6 +55,7 @@ HighScoreModel& HighScoreModel::operator=(const HighScoreModel& other)
 	beginInsertRows(QModelIndex(), 0, static_cast<int>(other.m_highScores.size()));
 	beginInsertColumns(QModelIndex(), 0, columnCount());
 	m_difficulty = other.m_difficulty;
+	m_boardSize  = other.m_boardSize;
 	m_highScores = other.m_highScores;
 	endInsertRows();
 	endInsertColumns();
@@ -101,6 +107,17 @@ void HighScoreModel::setDifficulty(HighScore::Difficulty difficulty)
 	m_difficulty = difficulty;
 }
 
+const BoardSize& HighScoreModel::boardSize() const
+{
+	return m_boardSize;
+}
+
+void HighScoreModel::setBoardSize(const BoardSize& boardSize)
+{
+	m_boardSize  = boardSize;
+	m_difficulty = boardSize.difficulty();
+}
+
 QModelIndex HighScoreModel::index(int row, int column, const QModelIndex& parent /*= QModelIndex()*/) const
 {
 	switch (column)
@@ -109,6 +126,10 @@ QModelIndex HighScoreModel::index(int row, int column, const QModelIndex& parent
 		return createIndex(row, column, Column::Name);
 	case Column::Score:
 		return createIndex(row, column, Column::Score);
+	case Column::ThreeBVPerSecond:
+		return createIndex(row, column, Column::ThreeBVPerSecond);
+	case Column::Efficiency:
+		return createIndex(row, column, Column::Efficiency);
 	case Column::Date:
 		return createIndex(row, column, Column::Date);
 	default:
@@ -128,7 +149,7 @@ int HighScoreModel::rowCount(const QModelIndex& parent /*= QModelIndex()*/) cons
 
 int HighScoreModel::columnCount(const QModelIndex& parent /*= QModelIndex()*/) const
 {
-	return 3;
+	return 5;
 }
 
 QVariant HighScoreModel::data(const QModelIndex& index, int role /*= Qt::DisplayRole*/) const
@@ -140,7 +161,17 @@ QVariant HighScoreModel::data(const QModelIndex& index, int role /*= Qt::Display
 		case Name:
 			return m_highScores[index.row()].name();
 		case Score:
-			return m_highScores[index.row()].score();
+			if (!m_highScores[index.row()].isPrecise())
+				return m_highScores[index.row()].score();
+			return QString::number(m_highScores[index.row()].time() / 1000.0, 'f', 3);
+		case ThreeBVPerSecond:
+			if (!m_highScores[index.row()].threeBV())
+				return {};
+			return QString::number(m_highScores[index.row()].threeBVPerSecond(), 'f', 2);
+		case Efficiency:
+			if (!m_highScores[index.row()].clicks())
+				return {};
+			return QString("%1%").arg(m_highScores[index.row()].efficiency(), 0, 'f', 0);
 		case Date:
 			return m_highScores[index.row()].date();
 		default:
@@ -156,6 +187,8 @@ QVariant HighScoreModel::data(const QModelIndex& index, int role /*= Qt::Display
 			alignment = Qt::AlignLeft | Qt::AlignVCenter;
 			break;
 		case Score: [[fallthrough]];
+		case ThreeBVPerSecond: [[fallthrough]];
+		case Efficiency: [[fallthrough]];
 		case Date: [[fallthrough]];
 		default:
 			alignment = Qt::AlignHCenter | Qt::AlignVCenter;
@@ -185,6 +218,10 @@ QVariant HighScoreModel::headerData(int section, Qt::Orientation orientation, in
 				return tr("Name");
 			case Column::Score:
 				return tr("Score");
+			case Column::ThreeBVPerSecond:
+				return tr("3BV/s");
+			case Column::Efficiency:
+				return tr("Efficiency");
 			case Column::Date:
 				return tr("Date");
 			default:
@@ -215,27 +252,67 @@ void HighScoreModel::setHighScores(const QVector<HighScore>& scores)
 	endInsertRows();
 }
 
-bool HighScoreModel::isHighScore(int time) const
+bool HighScoreModel::isHighScore(quint32 milliseconds) const
 {
-	return (rowCount() < MAX_HIGH_SCORES || time < index(rowCount() - 1, Score).data().toInt());
+	return (rowCount() < MAX_HIGH_SCORES || milliseconds < m_highScores.last().time());
+}
+
+void HighScoreModel::importLegacy(QDataStream& in)
+{
+	QString            difficulty;
+	QVector<HighScore> scores;
+
+	in >> difficulty;
+	in >> scores;
+	if (in.status() != QDataStream::Ok)
+		return;
+
+	// leaderboards used to be kept per difficulty. An old custom leaderboard never recorded its dimensions, so it
+	// comes back with an invalid size.
+	const auto legacyDifficulty = QVariant(difficulty).value<HighScore::Difficulty>();
+	setBoardSize(legacyDifficulty == HighScore::custom ? BoardSize{0, 0, 0} : BoardSize::preset(legacyDifficulty));
+	setHighScores(scores);
 }
 
 QDataStream& operator<<(QDataStream& out, const HighScoreModel& model)
 {
-	out << QVariant::fromValue(model.difficulty()).toString();
-	out << model.highScores();
+	out << model.boardSize() << static_cast<quint32>(model.highScores().size());
+	for (const auto& score : model.highScores())
+	{
+		// a score from before they were timed to the millisecond has none
+		out << score.name() << QVariant::fromValue(score.difficulty()).toString() << score.score() << (score.isPrecise() ? score.time() : 0u)
+			<< score.date() << score.threeBV() << score.clicks();
+	}
 	return out;
 }
 
 QDataStream& operator>>(QDataStream& in, HighScoreModel& model)
 {
-	QString            difficulty;
+	BoardSize          boardSize;
+	quint32            count = 0;
 	QVector<HighScore> scores;
 
-	in >> difficulty;
-	in >> scores;
+	in >> boardSize >> count;
+	for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i)
+	{
+		QString   name;
+		QString   difficulty;
+		quint32   seconds      = 0;
+		quint32   milliseconds = 0;
+		QDateTime date;
+		quint32   threeBV = 0;
+		quint32   clicks  = 0;
+		in >> name >> difficulty >> seconds >> milliseconds >> date >> threeBV >> clicks;
+
+		HighScore score(name, QVariant(difficulty).value<HighScore::Difficulty>(), milliseconds, date, threeBV, clicks);
+		if (!milliseconds)
+			score.setScore(seconds);
+		scores += score;
+	}
+	if (in.status() != QDataStream::Ok)
+		return in;
 
-	model.setDifficulty(QVariant(difficulty).value<HighScore::Difficulty>());
+	model.setBoardSize(boardSize);
 	model.setHighScores(scores);
 	return in;
 }
\ No newline at end of file
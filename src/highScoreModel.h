@@ -43,6 +43,7 @@
 #include <QDataStream>
 #include <QVector>
 
+#include "boardSize.h"
 #include "highScore.h"
 
 //-------------------------
@@ -55,9 +56,11 @@ public:
 
 	enum Column
 	{
-		Name  = 0,
-		Score = 1,
-		Date  = 2,
+		Name             = 0,
+		Score            = 1,
+		ThreeBVPerSecond = 2,
+		Efficiency       = 3,
+		Date             = 4,
 	};
 
 	Q_ENUM(Column);
@@ -65,7 +68,7 @@ public:
 public:
 
 	HighScoreModel() = default;
-	explicit HighScoreModel(HighScore::Difficulty difficulty, QObject* parent = nullptr);
+	explicit HighScoreModel(const BoardSize& boardSize, QObject* parent = nullptr);
 	HighScoreModel(const HighScoreModel& other);
 	HighScoreModel(HighScoreModel&& other) noexcept;
 	HighScoreModel& operator=(const HighScoreModel& other);
@@ -73,11 +76,16 @@ public:
 
 	void addHighScore(const HighScore& score);
 	void setDifficulty(HighScore::Difficulty difficulty);
+	void setBoardSize(const BoardSize& boardSize);
 	void setHighScores(const QVector<HighScore>& scores);
 
+	/// reads a leaderboard of a version before board sizes, kept per difficulty with its scores in whole seconds
+	void importLegacy(QDataStream& in);
+
 	[[nodiscard]] HighScore::Difficulty     difficulty() const;
+	[[nodiscard]] const BoardSize&          boardSize() const;
 	[[nodiscard]] const QVector<HighScore>& highScores() const;
-	[[nodiscard]] bool                      isHighScore(int time) const;
+	[[nodiscard]] bool                      isHighScore(quint32 milliseconds) const;
 
 	[[nodiscard]] QModelIndex   index(int row, int column, const QModelIndex& parent = QModelIndex()) const override;
 	[[nodiscard]] QModelIndex   parent(const QModelIndex& child) const override;
@@ -90,6 +98,7 @@ public:
 private:
 
 	HighScore::Difficulty m_difficulty{HighScore::beginner};
+	BoardSize             m_boardSize;
 	QVector<HighScore>    m_highScores;
 };
 
@@ -0,0 +1,134 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       imageCache.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `imageCache.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "imageCache.h"
+#include "trace.h"
+
+#include <QCoreApplication>
+#include <QFutureWatcher>
+#include <QGuiApplication>
+#include <QImage>
+#include <QPixmap>
+#include <QScreen>
+#include <QtConcurrent>
+
+#include <array>
+
+//----------------------------
+//  LOCAL DEFINITIONS
+//----------------------------
+
+namespace
+{
+	struct ImageSpec
+	{
+		const char* resource;
+		QSize       size;
+	};
+
+	/// indexed by `ImageCache::Image`
+	const std::array<ImageSpec, ImageCache::ImageCount> imageSpecs{{
+		{":/flag", {20, 20}},
+		{":/mine", {20, 20}},
+		{":/explosion", {20, 20}},
+		{":/tada", {22, 22}},
+		{":/wrong", {22, 22}},
+		{":/emoji/smile", {30, 30}},
+		{":/emoji/sunglasses", {30, 30}},
+		{":/emoji/injured", {30, 30}},
+		{":/emoji/wow", {30, 30}},
+	}};
+
+	/// `ImageCount` images per device pixel ratio
+	using DecodedImages = QList<QImage>;
+
+	std::array<QIcon, ImageCache::ImageCount> icons;
+	QFuture<DecodedImages>                    pending;
+	quint64                                   generation          = 0; // latest preload
+	quint64                                   installedGeneration = 0; // preload the icons were built from
+
+	DecodedImages decode(const QList<qreal>& ratios)
+	{
+		TRACE_SCOPE("ImageCache::decode");
+
+		// QImage (unlike QPixmap) is safe to use off the GUI thread
+		DecodedImages images;
+		for (auto ratio : ratios)
+		{
+			for (const auto& spec : imageSpecs)
+			{
+				QImage image = QImage(spec.resource).scaled(spec.size * ratio, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+				image.setDevicePixelRatio(ratio);
+				images.append(image);
+			}
+		}
+		return images;
+	}
+
+	void install(const DecodedImages& images, quint64 imagesGeneration)
+	{
+		TRACE_SCOPE("ImageCache::install");
+
+		icons = {};
+		for (qsizetype i = 0; i < images.size(); ++i)
+			icons[i % ImageCache::ImageCount].addPixmap(QPixmap::fromImage(images[i]));
+		installedGeneration = imagesGeneration;
+	}
+} // namespace
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+void ImageCache::preload()
+{
+	QList<qreal> ratios;
+	for (const auto* screen : QGuiApplication::screens())
+	{
+		if (!ratios.contains(screen->devicePixelRatio()))
+			ratios.append(screen->devicePixelRatio());
+	}
+	if (ratios.isEmpty())
+		ratios.append(1.0);
+
+	// icons stay valid (at the old ratios) until the new set is decoded
+	pending = QtConcurrent::run(decode, ratios);
+
+	auto* watcher = new QFutureWatcher<DecodedImages>(QCoreApplication::instance());
+	QObject::connect(watcher, &QFutureWatcherBase::finished, watcher,
+					 [watcher, preloadGeneration = ++generation]()
+					 {
+						 if (preloadGeneration == generation && preloadGeneration != installedGeneration)
+							 install(watcher->result(), preloadGeneration);
+						 watcher->deleteLater();
+					 });
+	watcher->setFuture(pending);
+}
+
+const QIcon& ImageCache::icon(Image image)
+{
+	// only blocks if an icon is needed before the initial decode has finished
+	if (!installedGeneration)
+	{
+		if (!pending.isValid())
+			preload();
+		install(pending.result(), generation);
+	}
+	return icons[image];
+}
\ No newline at end of file
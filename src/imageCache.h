@@ -0,0 +1,72 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       imageCache.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `ImageCache` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef IMAGECACHE_H
+#define IMAGECACHE_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include <QIcon>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: ImageCache
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Pre-decoded, pre-scaled icons for all of the game's imagery.
+/// @details `preload()` decodes and smooth-scales every image on a worker thread, once per distinct screen device
+///          pixel ratio, so neither the first explosion nor the first victory has to touch the resource file and
+///          high-DPI screens never rescale at paint time.
+//----------------------------------------------------------------------------------------------------------------------
+class ImageCache
+{
+public:
+
+	enum Image
+	{
+		Flag,
+		Mine,
+		Explosion,
+		Tada,
+		Wrong,
+		Smile,
+		Sunglasses,
+		Injured,
+		Wow,
+		ImageCount,
+	};
+
+public:
+
+	static void         preload();
+	static const QIcon& icon(Image image);
+};
+
+#endif // IMAGECACHE_H
\ No newline at end of file
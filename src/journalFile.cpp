@@ -0,0 +1,145 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       journalFile.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `journalFile.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "journalFile.h"
+#include "trace.h"
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <utility>
+
+//----------------------------
+//  LOCAL DEFINITIONS
+//----------------------------
+
+namespace
+{
+	/// `QFile::flush()` only hands the bytes to the system, this waits until they are on the disk
+	void syncToDisk(QFile& file)
+	{
+#ifdef Q_OS_WIN
+		_commit(file.handle());
+#else
+		fsync(file.handle());
+#endif
+	}
+} // namespace
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+JournalFile::JournalFile()
+{
+	// one writer, so the batches reach the file in the order they were appended
+	m_writer.setMaxThreadCount(1);
+}
+
+JournalFile::~JournalFile()
+{
+	close();
+}
+
+bool JournalFile::open(const QString& fileName, QIODevice::OpenMode mode)
+{
+	close();
+	m_file.setFileName(fileName);
+	m_open = m_file.open(mode);
+	return m_open;
+}
+
+void JournalFile::append(const QByteArray& data)
+{
+	if (!m_open || data.isEmpty())
+		return;
+
+	std::lock_guard lock(m_mutex);
+	if (m_pending.isEmpty() || m_pending.last().checkpoint)
+		m_pending.append({data, {}});
+	else
+		m_pending.last().data += data;
+	schedule();
+}
+
+void JournalFile::truncate(std::function<bool()> checkpoint)
+{
+	if (!m_open)
+		return;
+
+	std::lock_guard lock(m_mutex);
+	if (m_pending.isEmpty() || m_pending.last().checkpoint)
+		m_pending.append({{}, std::move(checkpoint)});
+	else
+		m_pending.last().checkpoint = std::move(checkpoint);
+	schedule();
+}
+
+void JournalFile::schedule()
+{
+	if (!std::exchange(m_writing, true))
+		m_writer.start([this] { writePending(); });
+}
+
+void JournalFile::close()
+{
+	if (!m_open)
+		return;
+
+	m_writer.waitForDone();
+	m_file.close();
+	m_open = false;
+}
+
+void JournalFile::writePending()
+{
+	TRACE_SCOPE("JournalFile::writePending");
+
+	for (;;)
+	{
+		QList<Batch> batches;
+		{
+			std::lock_guard lock(m_mutex);
+			if (m_pending.isEmpty())
+			{
+				m_writing = false;
+				return;
+			}
+			batches.swap(m_pending);
+		}
+
+		for (const auto& batch : batches)
+		{
+			if (!batch.data.isEmpty())
+			{
+				m_file.write(batch.data);
+				m_file.flush();
+				syncToDisk(m_file);
+			}
+			if (batch.checkpoint && batch.checkpoint())
+			{
+				m_file.resize(0);
+				syncToDisk(m_file);
+			}
+		}
+	}
+}
\ No newline at end of file
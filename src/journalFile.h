@@ -0,0 +1,103 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       journalFile.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `JournalFile` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef JOURNALFILE_H
+#define JOURNALFILE_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include <QByteArray>
+#include <QFile>
+#include <QList>
+#include <QThreadPool>
+
+#include <functional>
+#include <mutex>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: JournalFile
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief An append-only file that is written and synced to disk on a thread of its own.
+/// @details `append()` only queues the bytes, so the thread that plays the game never waits on the disk. The writer
+///          takes whatever has been queued, writes it and syncs it, and then does the same with whatever was queued
+///          in the meantime. A burst of appends while a sync is under way goes to disk together in the next one, so
+///          the syncs never pile up however fast the appends come. Once a sync returns, its bytes survive a crash of
+///          the game or of the whole machine.
+///
+///          `truncate()` is queued like an append, so it empties the file of what was appended before it and nothing
+///          appended after it.
+///
+///          Opening and closing the file happen on the calling thread, and closing waits for everything queued.
+//----------------------------------------------------------------------------------------------------------------------
+class JournalFile
+{
+public:
+
+	JournalFile();
+	~JournalFile();
+
+	JournalFile(const JournalFile&)            = delete;
+	JournalFile& operator=(const JournalFile&) = delete;
+
+	bool               open(const QString& fileName, QIODevice::OpenMode mode);
+	[[nodiscard]] bool isOpen() const noexcept { return m_open; }
+
+	void append(const QByteArray& data);
+	void close(); ///< once everything appended is on disk
+
+	/// empties the file once everything appended so far is on disk, if `checkpoint` then succeeds. It runs on the
+	/// writer, to put what the file holds somewhere else first.
+	void truncate(std::function<bool()> checkpoint);
+
+private:
+
+	void writePending();
+	void schedule(); ///< with the mutex held
+
+private:
+
+	struct Batch
+	{
+		QByteArray            data;
+		std::function<bool()> checkpoint; ///< runs once the data is on disk, see `truncate()`
+	};
+
+	QFile       m_file; ///< only touched by the writer while the file is open
+	QThreadPool m_writer;
+	bool        m_open = false;
+
+	std::mutex   m_mutex; ///< guards the two below
+	QList<Batch> m_pending;
+	bool         m_writing = false;
+};
+
+#endif // JOURNALFILE_H
\ No newline at end of file
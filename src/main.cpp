@@ -1,7 +1,13 @@
 #include <QApplication>
 #include <QStyleFactory>
 
+#include "benchmark.h"
+#include "replayAnalyzer.h"
+#include "replayEngine.h"
+#include "replayImport.h"
+#include "replayRecorder.h"
 #include "mainwindow.h"
+#include "imageCache.h"
 #include "highScore.h"
 #include "highScoreModel.h"
 
@@ -13,6 +19,26 @@ int main(int argc, char* argv[])
 	QCoreApplication::setOrganizationDomain("github.com/nholthaus");
 	QCoreApplication::setApplicationName("minesweeper");
 
+	// decode all game imagery in the background while the window is being built
+	ImageCache::preload();
+	QObject::connect(&app, &QGuiApplication::screenAdded, &app, [] { ImageCache::preload(); });
+
+	// headless check of the large-board budgets, see benchmark.h
+	if (app.arguments().contains("--benchmark"))
+		return Benchmark::run();
+
+	// headless verification of recorded games, see replayEngine.h
+	if (const qsizetype verify = app.arguments().indexOf("--verify-replays"); verify >= 0)
+		return ReplayEngine::run(app.arguments().value(verify + 1, ReplayRecorder::defaultDirectory()));
+
+	// headless analysis of recorded games, see replayAnalyzer.h
+	if (const qsizetype analyze = app.arguments().indexOf("--analyze-replays"); analyze >= 0)
+		return ReplayAnalyzer::run(app.arguments().value(analyze + 1, ReplayRecorder::defaultDirectory()));
+
+	// headless conversion of other programs' videos into the archive, see replayImport.h
+	if (const qsizetype import = app.arguments().indexOf("--import-replays"); import >= 0)
+		return ReplayImport::run(app.arguments().value(import + 1), app.arguments().value(import + 2, ReplayRecorder::defaultDirectory()));
+
 	MainWindow w;
 	w.show();
 
@@ -1,51 +1,71 @@
 #include "mainwindow.h"
 #include "appinfo.h"
+#include "customDifficultyDialog.h"
 #include "gameboard.h"
 #include "highScoreDialog.h"
 #include "highScoreModel.h"
+#include "imageCache.h"
 #include "mineCounter.h"
 #include "minetimer.h"
+#include "replay.h"
+#include "savedGame.h"
+#include "trace.h"
 
 #include <QDebug>
+#include <QDir>
+#include <QFileDialog>
+#include <QFileInfo>
 #include <QFrame>
 #include <QGuiApplication>
 #include <QInputDialog>
 #include <QMenuBar>
 #include <QMessageBox>
+#include <QSaveFile>
 #include <QSettings>
 #include <QSignalTransition>
 #include <QStatusBar>
 #include <QStyleHints>
-#include <QTimer>
 #include <QVBoxLayout>
 #include <qfile.h>
 #include <qstyle.h>
 
+#include "frameScheduler.h"
 #include "gameStatsDialog.h"
 
 MainWindow::MainWindow(QWidget* parent)
 	: QMainWindow(parent)
 	, mainFrame(nullptr)
+	, gameBoard(nullptr)
+	, endlessBoard(nullptr)
+	, m_replayArchive(ReplayRecorder::defaultDirectory())
+	, m_results(ResultJournal::defaultDirectory())
 	, m_versionChecker{"nholthaus", "minesweeper", APPINFO::version}
 {
 	this->setWindowIcon(QIcon(":/mine"));
 	setWindowFlags(Qt::MSWindowsFixedSizeDialogHint);
 	setupStateMachine();
 	setupMenus();
+	setupMainFrame();
 	loadSettings();
 
+	// the state machine starts a new game once the event loop runs, a game left by the last session comes after
+	connect(m_machine, &QStateMachine::started, this, &MainWindow::resumeSuspendedGame, Qt::SingleShotConnection);
+
 	connect(this, &MainWindow::defeat, this,
 			[this]()
 			{
-				newGame->setIcon(QIcon(":/emoji/injured"));
-				gameStats.addStat(this->difficulty, GameStats::Loss, mineTimer->time());
+				newGame->setIcon(ImageCache::icon(ImageCache::Injured));
+				if (countsForStats())
+					recordGame(GameStats::Loss);
 			});
 	connect(this, &MainWindow::victory, this,
 			[this]()
 			{
-				newGame->setIcon(QIcon(":/emoji/sunglasses"));
-				gameStats.addStat(this->difficulty, GameStats::Win, mineTimer->time());
+				newGame->setIcon(ImageCache::icon(ImageCache::Sunglasses));
+				if (countsForStats())
+					recordGame(GameStats::Win);
 			});
+	connect(this, &MainWindow::resumeGame, this, [this]() { newGame->setIcon(ImageCache::icon(ImageCache::Smile)); });
 	connect(&m_versionChecker, &VersionChecker::newerVersionAvailable, this,
 			[this](const QString& version, const QString& url)
 			{
@@ -65,78 +85,316 @@ void MainWindow::setDifficulty(HighScore::Difficulty difficulty)
 {
 	this->difficulty = difficulty;
 
-	switch (difficulty)
+	const BoardSize size = difficulty == HighScore::custom ? customSize : BoardSize::preset(difficulty);
+	numRows				 = size.rows;
+	numCols				 = size.columns;
+	numMines			 = size.mines;
+
+	checkDifficultyAction();
+
+	initialize();
+	adjustSize();
+}
+
+void MainWindow::checkDifficultyAction()
+{
+	switch (this->difficulty)
 	{
 	case HighScore::beginner:
-		numRows	 = 9;
-		numCols	 = 9;
-		numMines = 10;
 		beginnerAction->setChecked(true);
 		break;
 	case HighScore::intermediate:
-		numRows	 = 16;
-		numCols	 = 16;
-		numMines = 40;
 		intermediateAction->setChecked(true);
 		break;
 	case HighScore::expert:
-		numRows	 = 16;
-		numCols	 = 30;
-		numMines = 99;
 		expertAction->setChecked(true);
 		break;
 	case HighScore::custom:
+		customAction->setChecked(true);
+		break;
+	case HighScore::endless:
+		endlessAction->setChecked(true);
 		break;
 	default:
 		break;
 	}
+}
 
-	initialize();
+void MainWindow::chooseCustomDifficulty()
+{
+	CustomDifficultyDialog dialog(customSize, this);
+	if (dialog.exec() == QDialog::Accepted)
+	{
+		customSize = dialog.boardSize();
+		setDifficulty(HighScore::custom);
+	}
+	else
+	{
+		// keep the check mark on the difficulty that is still being played
+		checkDifficultyAction();
+	}
+}
+
+void MainWindow::watchReplay(const Replay& replay)
+{
+	if (!BoardSize{replay.rows, replay.columns, replay.mines}.isValid())
+		return;
+
+	QStringList speeds;
+	for (int speed = 1; speed <= GameBoard::MAX_REPLAY_SPEED; speed *= 2)
+		speeds += QString("%1x").arg(speed);
+
+	bool          ok    = false;
+	const QString speed = QInputDialog::getItem(this, tr("Watch Replay"), tr("Speed:"), speeds, 0, false, &ok);
+	if (!ok)
+		return;
+
+	// a game under way is given up first, exactly as for a new game: it is recorded as a forfeit and its board reset
+	// before the replay takes it over. The machine makes the transition before the signal returns.
+	if (m_machine->configuration().contains(inProgressState))
+		emit startNewGame();
+
+	// the replay takes over the regular board until the next new game
+	FrameScheduler::instance().cancel(this);
+	mineTimer->reset();
+	mineCounter->setNumMines(replay.mines);
+	newGame->setIcon(ImageCache::icon(ImageCache::Smile));
+	if (endlessBoard)
+		endlessBoard->hide();
+	gameBoard->show();
+	gameBoard->playReplay(replay, speed.chopped(1).toInt());
 	adjustSize();
 }
 
+BoardSize MainWindow::boardSize() const
+{
+	return {numRows, numCols, numMines};
+}
+
 void MainWindow::initialize()
 {
-	QFrame* newMainFrame	= new QFrame(this);
-	auto	mainFrameLayout = new QVBoxLayout;
-	auto	infoLayout		= new QHBoxLayout;
-	gameBoard				= new GameBoard(numRows, numCols, numMines, newMainFrame);
-	mineCounter				= new MineCounter(newMainFrame);
-	mineTimer				= new MineTimer(newMainFrame);
-	newGame					= new QPushButton(newMainFrame);
-	gameClock				= new QTimer(this);
-
-	mineCounter->setNumMines(numMines);
-
-	connect(gameBoard, &GameBoard::initialized, this, &MainWindow::startGame, Qt::UniqueConnection);
-	connect(gameBoard, &GameBoard::flagCountChanged, mineCounter, &MineCounter::setFlagCount, Qt::UniqueConnection);
-	connect(gameBoard, &GameBoard::victory, this, &MainWindow::victory, Qt::UniqueConnection);
-	connect(gameBoard, &GameBoard::defeat, this, &MainWindow::defeat, Qt::UniqueConnection);
+	TRACE_SCOPE("MainWindow::initialize");
+
+	// the board is built once. A new game of the same size resets it in place, and a change of dimensions re-lays
+	// out its pooled tiles, so neither allocates tiles unless the board grows past any size it has had before.
+	if (!gameBoard)
+	{
+		gameBoard = new GameBoard(numRows, numCols, numMines, mainFrame);
+		gameBoard->setReplayArchive(&m_replayArchive);
+
+		connect(gameBoard, &GameBoard::initialized, this, &MainWindow::startGame);
+		connect(gameBoard, &GameBoard::changed, mineCounter, &MineCounter::applyChanges);
+		connect(gameBoard, &GameBoard::changed, this, &MainWindow::updateMetrics);
+		connect(gameBoard, &GameBoard::changed, this, &MainWindow::updateHistoryActions);
+		connect(gameBoard, &GameBoard::resumed, this, &MainWindow::resumeGame);
+		connect(gameBoard, &GameBoard::victory, this, &MainWindow::victory);
+		connect(gameBoard, &GameBoard::defeat, this, &MainWindow::defeat);
+
+		mainFrameLayout->addWidget(gameBoard);
+	}
+	else if (gameBoard->numRows() == numRows && gameBoard->numCols() == numCols)
+	{
+		gameBoard->reset(numMines);
+	}
+	else
+	{
+		gameBoard->setDimensions(numRows, numCols, numMines);
+	}
+
+	// the endless board is only built once it is first played, and swaps places with the regular one
+	const bool endless = difficulty == HighScore::endless;
+	if (endless && !endlessBoard)
+	{
+		endlessBoard = new EndlessBoard(mainFrame);
+		endlessBoard->setTheme(QGuiApplication::styleHints()->colorScheme());
+
+		connect(endlessBoard, &EndlessBoard::initialized, this, &MainWindow::startGame);
+		connect(endlessBoard, &EndlessBoard::changed, this, [this]() { mineCounter->setCount(endlessBoard->revealedCount()); });
+		connect(endlessBoard, &EndlessBoard::defeat, this, &MainWindow::defeat);
+
+		mainFrameLayout->addWidget(endlessBoard);
+	}
+	else if (endless)
+	{
+		endlessBoard->reset();
+	}
+	gameBoard->setPracticeMode(practiceAction->isChecked());
+	gameBoard->setVisible(!endless);
+	if (endlessBoard)
+		endlessBoard->setVisible(endless);
+
+	FrameScheduler::instance().cancel(this);
+	if (endless)
+		mineCounter->setCount(0);
+	else
+		mineCounter->setNumMines(numMines);
+	mineTimer->reset();
+	updateMetrics();
+	updateHistoryActions();
+	newGame->setIcon(ImageCache::icon(ImageCache::Smile));
+}
+
+qint64 MainWindow::elapsed() const
+{
+	return difficulty == HighScore::endless && endlessBoard ? endlessBoard->elapsed() : gameBoard->elapsed();
+}
+
+void MainWindow::updateClock()
+{
+	const qint64 time = elapsed();
+	mineTimer->setTime(time);
+	updateMetrics();
+
+	// the next refresh is due when the clock reaches another whole second. It is read from the board each time, so a
+	// late refresh shows the right time instead of carrying the delay over.
+	FrameScheduler::instance().cancel(this);
+	if (m_machine->configuration().contains(inProgressState))
+		FrameScheduler::instance().schedule(this, 1000 - time % 1000, [this] { updateClock(); });
+}
+
+void MainWindow::updateSuspension()
+{
+	// nothing on the screen needs to change while it can't be seen. The boards keep time without being woken, and the
+	// clock is brought up to date as soon as the window is back.
+	const bool hidden = !isVisible() || isMinimized();
+	FrameScheduler::instance().setSuspended(hidden);
+	if (!hidden)
+		updateClock();
+}
+
+void MainWindow::updateMetrics()
+{
+	// an endless board can't be cleared, so it has no 3BV
+	if (difficulty == HighScore::endless)
+	{
+		metricsLabel->clear();
+		return;
+	}
+
+	const BoardCore::Metrics& metrics = gameBoard->metrics();
+	if (!metrics.threeBV)
+	{
+		metricsLabel->setText(tr("3BV -"));
+		return;
+	}
+
+	metricsLabel->setText(tr("3BV %1/%2\n%3/s  %4%")
+							  .arg(metrics.solvedThreeBV)
+							  .arg(metrics.threeBV)
+							  .arg(metrics.threeBVPerSecond(elapsed() / 1000.0), 0, 'f', 2)
+							  .arg(metrics.efficiency(), 0, 'f', 0));
+}
+
+void MainWindow::updateHistoryActions()
+{
+	const bool practice = difficulty != HighScore::endless && gameBoard->practiceMode();
+	undoAction->setEnabled(practice && gameBoard->canUndo());
+	redoAction->setEnabled(practice && gameBoard->canRedo());
+}
+
+void MainWindow::recordGame(GameStats::GameType type)
+{
+	// the result goes to disk as the game ends, the snapshot of all of them only every so often
+	const BoardSize           size    = boardSize();
+	const quint64             time    = static_cast<quint64>(gameBoard->elapsed());
+	const BoardCore::Metrics& metrics = gameBoard->metrics();
+	gameStats.addStat(size, type, time, metrics);
+	m_results.addGame(size, type, time, metrics);
+	if (m_results.needsCompaction())
+		m_results.compact(m_highScores, gameStats);
+}
+
+bool MainWindow::countsForStats() const
+{
+	// an endless board can't be won, and a practice game can be taken back
+	return difficulty != HighScore::endless && !gameBoard->practiceMode();
+}
+
+void MainWindow::suspendGame()
+{
+	TRACE_SCOPE("MainWindow::suspendGame");
+
+	// an endless board goes on forever, there is nothing to come back to
+	if (!m_machine->configuration().contains(inProgressState) || difficulty == HighScore::endless)
+		return;
+
+	auto game = gameBoard->suspend();
+	if (!game)
+		return;
+
+	QSaveFile file(SavedGame::defaultPath());
+	if (QDir().mkpath(QFileInfo(file.fileName()).absolutePath()) && file.open(QIODevice::WriteOnly))
+	{
+		file.write(game->encode());
+		file.commit();
+	}
+}
+
+void MainWindow::resumeSuspendedGame()
+{
+	TRACE_SCOPE("MainWindow::resumeSuspendedGame");
+
+	// a game put aside on close comes back as it was left. The snapshot is only used once, later moves are in the
+	// game's replay.
+	std::optional<SavedGame> game;
+	if (QFile file(SavedGame::defaultPath()); file.open(QIODevice::ReadOnly))
+	{
+		game = SavedGame::decode(file.readAll());
+		file.remove();
+	}
+
+	// the difficulty of the game was saved along with it, anything else is stale
+	if (game && difficulty != HighScore::endless && BoardSize{game->rows, game->columns, game->mines} == boardSize())
+	{
+		gameBoard->resume(*game);
+	}
+	else if (const auto replay = gameBoard->interruptedGame())
+	{
+		// a game cut short by a crash is played again from its replay. The settings are from before the crash, so
+		// the game decides the difficulty.
+		const BoardSize size{replay->rows, replay->columns, replay->mines};
+		if (size.isValid() && (size != boardSize() || difficulty == HighScore::endless))
+		{
+			if (size.difficulty() == HighScore::custom)
+				customSize = size;
+			setDifficulty(size.difficulty());
+		}
+
+		gameBoard->resume(*replay);
+	}
+	updateHistoryActions();
+}
+
+void MainWindow::setupMainFrame()
+{
+	mainFrame		= new QFrame(this);
+	mainFrameLayout = new QVBoxLayout;
+	auto infoLayout = new QHBoxLayout;
+	mineCounter		= new MineCounter(mainFrame);
+	mineTimer		= new MineTimer(mainFrame);
+	metricsLabel	= new QLabel(mainFrame);
+	newGame			= new QPushButton(mainFrame);
 
 	newGame->setMinimumSize(35, 35);
 	newGame->setIconSize(QSize(30, 30));
-	newGame->setIcon(QIcon(":/emoji/smile"));
+	newGame->setIcon(ImageCache::icon(ImageCache::Smile));
 	connect(newGame, &QPushButton::clicked, this, &MainWindow::startNewGame, Qt::UniqueConnection);
 
-	gameClock->setInterval(1000);
-	connect(gameClock, &QTimer::timeout, mineTimer, &MineTimer::incrementTime, Qt::UniqueConnection);
+	metricsLabel->setAlignment(Qt::AlignRight | Qt::AlignVCenter);
+	metricsLabel->setToolTip(tr("3BV solved of the board's total, 3BV per second and efficiency"));
 
 	infoLayout->addWidget(mineCounter);
 	infoLayout->addSpacerItem(new QSpacerItem(0, 0, QSizePolicy::MinimumExpanding));
 	infoLayout->addWidget(newGame);
 	infoLayout->addSpacerItem(new QSpacerItem(0, 0, QSizePolicy::MinimumExpanding));
+	infoLayout->addWidget(metricsLabel);
 	infoLayout->addWidget(mineTimer);
 
 	mainFrameLayout->addLayout(infoLayout);
-	mainFrameLayout->addWidget(gameBoard);
-
-	newMainFrame->setLayout(mainFrameLayout);
+	mainFrame->setLayout(mainFrameLayout);
 
 	this->setSizePolicy(QSizePolicy::Minimum, QSizePolicy::Minimum);
-	this->setCentralWidget(newMainFrame);
-
-	std::swap(mainFrame, newMainFrame);
-	delete newMainFrame;
+	this->setCentralWidget(mainFrame);
 }
 
 void MainWindow::setupStateMachine()
@@ -149,6 +407,7 @@ void MainWindow::setupStateMachine()
 	defeatState		= new QState;
 
 	unstartedState->addTransition(this, &MainWindow::startGame, inProgressState);
+	unstartedState->addTransition(this, &MainWindow::startNewGame, unstartedState); // ends a replay
 
 	inProgressState->addTransition(this, &MainWindow::victory, victoryState);
 	inProgressState->addTransition(this, &MainWindow::defeat, defeatState);
@@ -158,20 +417,29 @@ void MainWindow::setupStateMachine()
 
 	defeatState->addTransition(this, &MainWindow::startNewGame, unstartedState);
 
+	// practice games can be taken back past their end
+	victoryState->addTransition(this, &MainWindow::resumeGame, inProgressState);
+	defeatState->addTransition(this, &MainWindow::resumeGame, inProgressState);
+
 	connect(unstartedState, &QState::entered, [this]() { initialize(); });
 
-	connect(inProgressState, &QState::entered, [this]() { gameClock->start(); });
+	connect(inProgressState, &QState::entered, [this]() { updateClock(); });
 
-	connect(forfeitTransition, &QSignalTransition::triggered, [this]() { gameStats.addStat(this->difficulty, GameStats::Forfeit, mineTimer->time()); });
+	connect(forfeitTransition, &QSignalTransition::triggered,
+			[this]()
+			{
+				if (countsForStats())
+					recordGame(GameStats::Forfeit);
+			});
 
 	connect(victoryState, &QState::entered,
 			[this]()
 			{
-				gameClock->stop();
+				updateClock();
 				onVictory();
 			});
 
-	connect(defeatState, &QState::entered, [this]() { gameClock->stop(); });
+	connect(defeatState, &QState::entered, [this]() { updateClock(); });
 
 	m_machine->addState(unstartedState);
 	m_machine->addState(inProgressState);
@@ -184,23 +452,26 @@ void MainWindow::setupStateMachine()
 
 void MainWindow::onVictory()
 {
-	if (!m_highScores.contains(difficulty))
-		m_highScores.insert(difficulty, HighScoreModel(difficulty));
+	const BoardSize size = boardSize();
+	if (!m_highScores.contains(size))
+		m_highScores.insert(size, HighScoreModel(size));
 
-	if (m_highScores[difficulty].isHighScore(mineTimer->time()))
+	const auto time = static_cast<quint32>(gameBoard->elapsed());
+	if (countsForStats() && m_highScores[size].isHighScore(time))
 	{
 		auto name = QInputDialog::getText(this, tr("Congratulations!"), tr("You've earned a high score!<br>Please enter your name:"));
-		m_highScores[difficulty].addHighScore(HighScore(name, difficulty, mineTimer->time(), QDateTime::currentDateTime()));
+		const BoardCore::Metrics& metrics = gameBoard->metrics();
+		const HighScore           score(name, difficulty, time, QDateTime::currentDateTime(), metrics.threeBV, metrics.clicks);
+		m_highScores[size].addHighScore(score);
+		m_results.addHighScore(size, score);
 		highScoreAction->trigger();
 	}
 }
 
 void MainWindow::closeEvent(QCloseEvent* event)
 {
-	if (m_machine->configuration().contains(inProgressState))
-	{
-		gameStats.addStat(this->difficulty, GameStats::Forfeit, mineTimer->time());
-	}
+	// a game under way is put aside for the next start instead of given up, only starting another one forfeits it
+	suspendGame();
 	saveSettings();
 }
 
@@ -212,6 +483,29 @@ void MainWindow::setupMenus()
 	newGameAction->setShortcut(QKeySequence(Qt::Key_F2));
 	connect(newGameAction, &QAction::triggered, this, &MainWindow::startNewGame);
 
+	undoAction = new QAction(tr("Undo"));
+	undoAction->setShortcut(QKeySequence::Undo);
+	undoAction->setEnabled(false);
+	connect(undoAction, &QAction::triggered, this, [this]() { gameBoard->undo(); });
+
+	redoAction = new QAction(tr("Redo"));
+	redoAction->setShortcut(QKeySequence::Redo);
+	redoAction->setEnabled(false);
+	connect(redoAction, &QAction::triggered, this, [this]() { gameBoard->redo(); });
+
+	practiceAction = new QAction(tr("Practice Mode"));
+	practiceAction->setCheckable(true);
+	practiceAction->setStatusTip(tr("Moves can be undone. Practice games don't count toward high scores or statistics and aren't recorded."));
+	connect(practiceAction, &QAction::toggled, this,
+			[this](bool checked)
+			{
+				// the board is only built once the settings are loaded, which picks the mode up from here
+				if (!gameBoard)
+					return;
+				gameBoard->setPracticeMode(checked);
+				updateHistoryActions();
+			});
+
 	difficultyMenu		  = new QMenu(tr("Difficulty"));
 	difficultyActionGroup = new QActionGroup(difficultyMenu);
 
@@ -227,22 +521,36 @@ void MainWindow::setupMenus()
 	expertAction->setCheckable(true);
 	connect(expertAction, &QAction::triggered, [this]() { setDifficulty(HighScore::expert); });
 
+	customAction = new QAction(tr("Custom..."), difficultyActionGroup);
+	customAction->setCheckable(true);
+	connect(customAction, &QAction::triggered, this, &MainWindow::chooseCustomDifficulty);
+
+	endlessAction = new QAction(tr("Endless"), difficultyActionGroup);
+	endlessAction->setCheckable(true);
+	connect(endlessAction, &QAction::triggered, [this]() { setDifficulty(HighScore::endless); });
+
 	difficultyMenu->addAction(beginnerAction);
 	difficultyMenu->addAction(intermediateAction);
 	difficultyMenu->addAction(expertAction);
+	difficultyMenu->addSeparator();
+	difficultyMenu->addAction(customAction);
+	difficultyMenu->addAction(endlessAction);
 
 	highScoreAction = new QAction(tr("High Scores..."));
 	connect(
 		highScoreAction, &QAction::triggered, this,
 		[this]()
 		{
-			QString difficulty = QVariant::fromValue(this->difficulty).toString();
-			QString tabName	   = difficulty[0].toUpper() + difficulty.mid(1).toLower();
-
-			auto* dialog = new HighScoreDialog(m_highScores, this);
-			dialog->setActiveTab(tabName);
-			dialog->exec();
-			dialog->deleteLater();
+			// the replay adds to the archive the dialog reads, so the dialog is gone first
+			std::optional<Replay> replay;
+			{
+				HighScoreDialog dialog(m_highScores, m_replayArchive, this);
+				dialog.setActiveTab(boardSize().name());
+				if (dialog.exec() == QDialog::Accepted)
+					replay = dialog.selectedReplay();
+			}
+			if (replay)
+				watchReplay(*replay);
 		},
 		Qt::QueuedConnection);
 
@@ -251,24 +559,41 @@ void MainWindow::setupMenus()
 		statisticsAction, &QAction::triggered, this,
 		[this]()
 		{
-			QString difficulty = QVariant::fromValue(this->difficulty).toString();
-			QString tabName	   = difficulty[0].toUpper() + difficulty.mid(1).toLower();
-
-			auto* dialog = new GameStatsDialog(gameStats, this);
-			dialog->setActiveTab(tabName);
-			dialog->exec();
-			dialog->deleteLater();
+			// the dialog reads the replay archive from worker threads, so it is gone before the replay adds to it
+			std::optional<Replay> replay;
+			{
+				GameStatsDialog dialog(gameStats, m_replayArchive, this);
+				dialog.setActiveTab(boardSize().name());
+				if (dialog.exec() == QDialog::Accepted)
+					replay = dialog.selectedReplay();
+			}
+			if (replay)
+				watchReplay(*replay);
 		},
 		Qt::QueuedConnection);
 
+	watchReplayAction = new QAction(tr("Watch Last Game..."));
+	connect(watchReplayAction, &QAction::triggered, this,
+			[this]
+			{
+				if (const auto replay = m_replayArchive.replay(m_replayArchive.size() - 1))
+					watchReplay(*replay);
+				else
+					QMessageBox::information(this, tr("Watch Last Game"), tr("There is no recorded game to watch yet."));
+			});
+
 	exitAction = new QAction(tr("Exit"));
 	connect(exitAction, &QAction::triggered, this, &QMainWindow::close);
 
 	gameMenu->addAction(newGameAction);
+	gameMenu->addAction(undoAction);
+	gameMenu->addAction(redoAction);
 	gameMenu->addSeparator();
 	gameMenu->addMenu(difficultyMenu);
+	gameMenu->addAction(practiceAction);
 	gameMenu->addAction(highScoreAction);
 	gameMenu->addAction(statisticsAction);
+	gameMenu->addAction(watchReplayAction);
 	gameMenu->addSeparator();
 	gameMenu->addAction(exitAction);
 
@@ -277,11 +602,27 @@ void MainWindow::setupMenus()
 	aboutAction		   = new QAction(tr("About..."));
 	aboutQtAction	   = new QAction(tr("About Qt..."));
 	checkVersionAction = new QAction(tr("Check for Updates..."));
+	diagnosticsAction  = new QAction(tr("Diagnostics..."));
 
 	helpMenu->addAction(aboutAction);
 	helpMenu->addAction(aboutQtAction);
 	helpMenu->addSeparator();
 	helpMenu->addAction(checkVersionAction);
+	helpMenu->addAction(diagnosticsAction);
+
+#ifdef MINESWEEPER_TRACING
+	saveTraceAction = new QAction(tr("Save Trace..."));
+	helpMenu->addSeparator();
+	helpMenu->addAction(saveTraceAction);
+
+	connect(saveTraceAction, &QAction::triggered, this,
+			[this]
+			{
+				auto fileName = QFileDialog::getSaveFileName(this, tr("Save Trace"), "minesweeper.trace.json", tr("Chrome Trace (*.json)"));
+				if (!fileName.isEmpty() && !Trace::writeChromeTrace(fileName))
+					QMessageBox::warning(this, tr("Save Trace"), tr("Unable to write %1").arg(fileName));
+			});
+#endif
 
 	aboutAction->setIcon(QIcon(":/mine"));
 	aboutQtAction->setIcon(this->style()->standardIcon(QStyle::SP_TitleBarMenuButton));
@@ -312,65 +653,72 @@ void MainWindow::setupMenus()
 					Qt::SingleShotConnection);
 			});
 
+	// how often the game has woken up since launch, which should be rarely while nothing moves
+	connect(diagnosticsAction, &QAction::triggered, this,
+			[this]
+			{
+				const auto& scheduler = FrameScheduler::instance();
+				QMessageBox::information(this, tr("Diagnostics"),
+										 tr("Frame wakeups: %1\nIdle wakeups: %2").arg(scheduler.frameWakeups()).arg(scheduler.idleWakeups()));
+			});
+
 	this->menuBar()->addMenu(gameMenu);
 	this->menuBar()->addMenu(helpMenu);
 }
 
 void MainWindow::saveSettings()
 {
+	TRACE_SCOPE("MainWindow::saveSettings");
+
 	QSettings settings(APPINFO::organization, APPINFO::name);
 	settings.setValue("difficulty", QVariant::fromValue(difficulty).toString());	// last difficulty played
-	settings.beginWriteArray("High Scores", static_cast<int>(m_highScores.size())); // high scores for all difficulties
-	int i = 0;
-	for (const auto& model : m_highScores)
-	{
-		QByteArray	data;
-		QDataStream stream(&data, QIODevice::WriteOnly);
-		stream << model;
-
-		settings.setArrayIndex(i++);
-		settings.setValue("difficulty", model.difficulty());
-		settings.setValue("model", data);
-	}
-	settings.endArray();
-	{
-		QByteArray	data;
-		QDataStream stream(&data, QIODevice::WriteOnly);
-		stream << gameStats;
-		settings.setValue("stats", data);
-	}
-	settings.endArray();
+	settings.setValue("customRows", customSize.rows);								// last custom board
+	settings.setValue("customColumns", customSize.columns);
+	settings.setValue("customMines", customSize.mines);
+	settings.setValue("practice", practiceAction->isChecked());
 }
 
 void MainWindow::loadSettings()
 {
+	TRACE_SCOPE("MainWindow::loadSettings");
+
 	QSettings settings(APPINFO::organization, APPINFO::name);
+	customSize.rows	   = settings.value("customRows", customSize.rows).toUInt();
+	customSize.columns = settings.value("customColumns", customSize.columns).toUInt();
+	customSize.mines   = settings.value("customMines", customSize.mines).toUInt();
+	if (!customSize.isValid())
+		customSize = BoardSize{};
+	practiceAction->setChecked(settings.value("practice", false).toBool());
 	setDifficulty(settings.value("difficulty").value<HighScore::Difficulty>());
 
-	m_highScores.insert(HighScore::beginner, HighScoreModel{HighScore::beginner});
-	m_highScores.insert(HighScore::intermediate, HighScoreModel{HighScore::intermediate});
-	m_highScores.insert(HighScore::expert, HighScoreModel{HighScore::expert});
+	for (auto difficulty : {HighScore::beginner, HighScore::intermediate, HighScore::expert})
+		m_highScores.insert(BoardSize::preset(difficulty), HighScoreModel{BoardSize::preset(difficulty)});
 
-	const int size = settings.beginReadArray("High Scores");
-	for (int i = 0; i < size; ++i)
+	// the results were kept in the settings, and written there as a whole on close, before they were journaled
+	if (!m_results.hasSnapshot())
 	{
-		settings.setArrayIndex(i);
+		const int size = settings.beginReadArray("High Scores");
+		for (int i = 0; i < size; ++i)
+		{
+			settings.setArrayIndex(i);
 
-		HighScoreModel model;
-		QByteArray	   data = settings.value("model").toByteArray();
-		QDataStream	   stream(&data, QIODevice::ReadOnly);
-		stream >> model;
+			HighScoreModel model;
+			QByteArray	   data = settings.value("model").toByteArray();
+			QDataStream	   stream(&data, QIODevice::ReadOnly);
+			model.importLegacy(stream);
+
+			if (model.boardSize().isValid())
+				m_highScores[model.boardSize()] = std::move(model);
+		}
+		settings.endArray();
 
-		m_highScores[model.difficulty()] = std::move(model);
-	}
-	settings.endArray();
-	{
 		QByteArray	data = settings.value("stats").toByteArray();
 		QDataStream stream(&data, QIODevice::ReadOnly);
-		stream >> gameStats;
+		gameStats.importLegacy(stream);
 	}
 
-	settings.endArray();
+	if (!m_results.load(m_highScores, gameStats) || m_results.needsCompaction())
+		m_results.compact(m_highScores, gameStats);
 }
 
 void MainWindow::changeEvent(QEvent* event)
@@ -379,12 +727,31 @@ void MainWindow::changeEvent(QEvent* event)
 	{
 		this->setTheme(QGuiApplication::styleHints()->colorScheme());
 	}
+	else if (event->type() == QEvent::WindowStateChange)
+	{
+		updateSuspension();
+	}
 	QMainWindow::changeEvent(event);
 }
 
+void MainWindow::showEvent(QShowEvent* event)
+{
+	QMainWindow::showEvent(event);
+	updateSuspension();
+}
+
+void MainWindow::hideEvent(QHideEvent* event)
+{
+	QMainWindow::hideEvent(event);
+	updateSuspension();
+}
+
 void MainWindow::setTheme(Qt::ColorScheme colorScheme)
 {
-	gameBoard->setTheme(colorScheme);
+	if (gameBoard)
+		gameBoard->setTheme(colorScheme);
+	if (endlessBoard)
+		endlessBoard->setTheme(colorScheme);
 	mineCounter->setTheme(colorScheme);
 	mineTimer->setTheme(colorScheme);
 }
\ No newline at end of file
@@ -1,20 +1,26 @@
 #pragma once
 
+#include "boardSize.h"
 #include "tile.h"
 #include "gameboard.h"
+#include "endlessBoard.h"
 #include "mineCounter.h"
 #include "minetimer.h"
 #include "highScoreModel.h"
 #include "gameStats.h"
+#include "replayArchive.h"
+#include "resultJournal.h"
 
 #include <QAction>
 #include <QActionGroup>
 #include <QMenu>
 #include <QFrame>
+#include <QLabel>
 #include <QPushButton>
 #include <QMainWindow>
 #include <QStateMachine>
 #include <QState>
+#include <QVBoxLayout>
 
 #include "versionChecker.h"
 
@@ -34,6 +40,7 @@ signals:
 	void victory();
 	void defeat();
 	void startNewGame();
+	void resumeGame(); ///< an undo took back the end of a practice game
 
 protected slots:
 
@@ -46,7 +53,21 @@ protected:
 private:
 
 	void setDifficulty(HighScore::Difficulty difficulty);
+	void chooseCustomDifficulty();
+	void watchReplay(const Replay& replay);
+	BoardSize boardSize() const;
 	void initialize();
+	qint64 elapsed() const;
+	void updateClock();
+	void updateSuspension();
+	void updateMetrics();
+	void updateHistoryActions();
+	void checkDifficultyAction();
+	bool countsForStats() const;
+	void recordGame(GameStats::GameType type);
+	void suspendGame();
+	void resumeSuspendedGame();
+	void setupMainFrame();
 	void setupStateMachine();
 	void saveSettings();
 	void loadSettings();
@@ -54,34 +75,44 @@ private:
 protected:
 
 	void changeEvent(QEvent*) override;
+	void showEvent(QShowEvent* event) override;
+	void hideEvent(QHideEvent* event) override;
 	void setTheme(Qt::ColorScheme colorScheme);
 
 private:
 
-	QFrame*      mainFrame;
-	GameBoard*   gameBoard;
-	MineCounter* mineCounter;
-	MineTimer*   mineTimer;
-	QPushButton* newGame;
+	QFrame*       mainFrame;
+	QVBoxLayout*  mainFrameLayout;
+	GameBoard*    gameBoard;
+	EndlessBoard* endlessBoard;
+	MineCounter*  mineCounter;
+	MineTimer*    mineTimer;
+	QLabel*       metricsLabel;
+	QPushButton*  newGame;
 
 	QMenu*        gameMenu;
 	QAction*      newGameAction;
+	QAction*      undoAction;
+	QAction*      redoAction;
+	QAction*      practiceAction;
 	QMenu*        difficultyMenu;
 	QActionGroup* difficultyActionGroup;
 	QAction*      beginnerAction;
 	QAction*      intermediateAction;
 	QAction*      expertAction;
 	QAction*      customAction;
+	QAction*      endlessAction;
 	QAction*      highScoreAction;
 	QAction*      statisticsAction;
+	QAction*      watchReplayAction;
 	QAction*      exitAction;
 
 	QMenu*   helpMenu;
 	QAction* aboutAction;
 	QAction* aboutQtAction;
 	QAction* checkVersionAction;
-
-	QTimer* gameClock;
+	QAction* diagnosticsAction;
+	QAction* saveTraceAction;
 
 	QStateMachine* m_machine;
 	QState*        unstartedState;
@@ -96,9 +127,12 @@ private:
 	quint32 numMines;
 
 	HighScore::Difficulty difficulty;
+	BoardSize             customSize;
 	GameStats             gameStats;
 
-	QMap<HighScore::Difficulty, HighScoreModel> m_highScores;
+	QMap<BoardSize, HighScoreModel> m_highScores;
+	ReplayArchive                   m_replayArchive;
+	ResultJournal                   m_results; ///< where `gameStats` and `m_highScores` are kept
 
 	VersionChecker m_versionChecker;
 };
\ No newline at end of file
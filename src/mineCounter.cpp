@@ -2,8 +2,12 @@
 #include <QGuiApplication>
 #include <QStyleHints>
 
+#include <algorithm>
+
 MineCounter::MineCounter(QWidget* parent)
 	: QLCDNumber(parent)
+	, m_totalMines(0)
+	, m_flagCount(0)
 {
 	this->setDigitCount(3);
 	this->display(0);
@@ -15,13 +19,37 @@ MineCounter::MineCounter(QWidget* parent)
 void MineCounter::setNumMines(int numMines)
 {
 	m_totalMines = numMines;
+	m_flagCount  = 0;
+
+	// custom boards can have more mines than the classic three digits hold
+	setDigitCount(std::max(3, static_cast<int>(QString::number(numMines).size())));
+	updateGeometry();
 	display(m_totalMines);
 }
 
-void MineCounter::setFlagCount(unsigned int flagCount)
+void MineCounter::setCount(quint64 count)
 {
-	m_flagCount = flagCount;
-	display((int)m_totalMines - (int)flagCount);
+	// an endless game has no total to count down from, so the counter shows how many cells have been revealed. Most
+	// changes are flags, which leave it as it is.
+	if (count == static_cast<quint64>(intValue()))
+		return;
+
+	const int digits = std::max(3, static_cast<int>(QString::number(count).size()));
+	if (digits != digitCount())
+	{
+		setDigitCount(digits);
+		updateGeometry();
+	}
+	display(QString::number(count));
+}
+
+void MineCounter::applyChanges(const BoardChanges& changes)
+{
+	if (!changes.flagDelta)
+		return;
+
+	m_flagCount += changes.flagDelta;
+	display(m_totalMines - m_flagCount);
 }
 
 void MineCounter::setTheme(Qt::ColorScheme colorScheme)
@@ -34,5 +62,5 @@ void MineCounter::setTheme(Qt::ColorScheme colorScheme)
 
 QSize MineCounter::sizeHint() const
 {
-	return QSize(65, 35);
+	return QSize(20 * digitCount() + 5, 35);
 }
\ No newline at end of file
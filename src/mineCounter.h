@@ -1,18 +1,21 @@
 #pragma once
 #include <QLCDNumber>
 
+#include "boardChanges.h"
+
 class MineCounter : public QLCDNumber
 {
 public:
 	MineCounter(QWidget* parent = nullptr);
 
 	void setNumMines(int numMines);
-	void setFlagCount(unsigned int flagCount);
+	void setCount(quint64 count);
+	void applyChanges(const BoardChanges& changes);
 	void setTheme(Qt::ColorScheme colorScheme);
 	virtual QSize sizeHint() const override;
 
 private:
 
 	int m_totalMines;
-	unsigned int m_flagCount;
+	int m_flagCount;
 };
\ No newline at end of file
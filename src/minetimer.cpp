@@ -13,9 +13,20 @@ MineTimer::MineTimer(QWidget* parent /*= nullptr*/)
 	this->setTheme(QGuiApplication::styleHints()->colorScheme());
 }
 
-void MineTimer::incrementTime()
+void MineTimer::reset()
 {
-	display(++m_seconds);
+	m_seconds = 0;
+	display(m_seconds);
+}
+
+void MineTimer::setTime(qint64 milliseconds)
+{
+	const int seconds = static_cast<int>(milliseconds / 1000);
+	if (seconds == m_seconds)
+		return;
+
+	m_seconds = seconds;
+	display(m_seconds);
 }
 
 int MineTimer::time() const
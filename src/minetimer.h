@@ -6,8 +6,9 @@ class MineTimer : public QLCDNumber
 public:
 	MineTimer(QWidget* parent = nullptr);
 
-	void incrementTime();
-	int time() const;
+	void reset();
+	void setTime(qint64 milliseconds); ///< shows the whole seconds, repainting only when they change
+	int time() const;                  ///< seconds shown
 	void setTheme(Qt::ColorScheme colorScheme);
 	virtual QSize sizeHint() const override;
 
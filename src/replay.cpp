@@ -0,0 +1,224 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       replay.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `replay.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "replay.h"
+
+#include <QtEndian>
+
+//----------------------------
+//  LOCAL DEFINITIONS
+//----------------------------
+
+namespace
+{
+	constexpr int ACTION_BITS = 3;
+
+	void appendVarint(QByteArray& out, quint64 value)
+	{
+		while (value >= 0x80)
+		{
+			out += static_cast<char>(value | 0x80);
+			value >>= 7;
+		}
+		out += static_cast<char>(value);
+	}
+
+	quint64 zigzag(qint64 value) noexcept { return (static_cast<quint64>(value) << 1) ^ static_cast<quint64>(value >> 63); }
+
+	qint64 unzigzag(quint64 value) noexcept { return static_cast<qint64>(value >> 1) ^ -static_cast<qint64>(value & 1); }
+
+	/// reads from a byte range and stays put once it runs out, so a truncated recording is detected at the end
+	class Reader
+	{
+	public:
+
+		explicit Reader(QByteArrayView data)
+			: m_data(data)
+		{
+		}
+
+		[[nodiscard]] bool atEnd() const noexcept { return m_position >= m_data.size(); }
+		[[nodiscard]] bool ok() const noexcept { return m_ok; }
+
+		quint64 varint()
+		{
+			quint64 value = 0;
+			for (int shift = 0; shift < 64; shift += 7)
+			{
+				if (atEnd())
+					break;
+
+				const auto byte = static_cast<quint8>(m_data[m_position++]);
+				value |= static_cast<quint64>(byte & 0x7F) << shift;
+				if (!(byte & 0x80))
+					return value;
+			}
+			m_ok = false;
+			return 0;
+		}
+
+		QByteArrayView bytes(qsizetype count)
+		{
+			if (m_data.size() - m_position < count)
+			{
+				m_ok = false;
+				return {};
+			}
+			const QByteArrayView view = m_data.sliced(m_position, count);
+			m_position += count;
+			return view;
+		}
+
+	private:
+
+		QByteArrayView m_data;
+		qsizetype      m_position = 0;
+		bool           m_ok       = true;
+	};
+} // namespace
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+void Replay::placeMines(BoardCore& core) const
+{
+	if (layout.empty())
+		core.placeMines(firstCell, seed);
+	else
+		core.placeMines(layout);
+}
+
+QByteArray Replay::encode() const
+{
+	QByteArray out;
+	appendHeader(out, *this);
+
+	Event previous = origin();
+	for (const auto& event : events)
+	{
+		appendEvent(out, event, previous);
+		previous = event;
+	}
+	if (result != Result::Unfinished)
+		appendEnd(out, result, duration, previous);
+
+	return out;
+}
+
+std::optional<Replay> Replay::decode(QByteArrayView data)
+{
+	Reader reader(data);
+	if (reader.bytes(sizeof(MAGIC)) != QByteArrayView(MAGIC, sizeof(MAGIC)))
+		return std::nullopt;
+
+	const QByteArrayView version = reader.bytes(1);
+	if (!reader.ok() || static_cast<quint8>(version[0]) != VERSION)
+		return std::nullopt;
+
+	Replay replay;
+	replay.rows      = static_cast<quint32>(reader.varint());
+	replay.columns   = static_cast<quint32>(reader.varint());
+	replay.mines     = static_cast<quint32>(reader.varint());
+	replay.firstCell = static_cast<BoardCore::Index>(reader.varint());
+	replay.started   = QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(reader.varint()));
+
+	const QByteArrayView seed = reader.bytes(sizeof(quint64));
+	if (!reader.ok())
+		return std::nullopt;
+	replay.seed = qFromLittleEndian<quint64>(seed.data());
+
+	// bounded by the board, so a damaged count can't make it allocate without limit
+	const quint64 count = reader.varint();
+	if (!reader.ok() || count > static_cast<quint64>(replay.rows) * replay.columns)
+		return std::nullopt;
+
+	replay.layout.resize(static_cast<size_t>(count));
+	BoardCore::Index cell = 0;
+	for (auto& mine : replay.layout)
+		mine = cell += static_cast<BoardCore::Index>(reader.varint());
+	if (!reader.ok())
+		return std::nullopt;
+
+	// events up to the last complete one. A partial record at the end is what an interrupted recording looks like.
+	Event previous = replay.origin();
+	while (!reader.atEnd())
+	{
+		const quint64 timeAndAction = reader.varint();
+		const quint64 cell          = reader.varint();
+		if (!reader.ok())
+			break;
+
+		Event event;
+		event.time   = previous.time + (timeAndAction >> ACTION_BITS);
+		event.action = static_cast<Action>(timeAndAction & ((1 << ACTION_BITS) - 1));
+		if (event.action == Action::End)
+		{
+			replay.result   = cell <= static_cast<quint64>(Result::Forfeit) ? static_cast<Result>(cell) : Result::Unfinished;
+			replay.duration = event.time;
+			break;
+		}
+		if (event.action > Action::End)
+			break;
+
+		event.cell = static_cast<BoardCore::Index>(static_cast<qint64>(previous.cell) + unzigzag(cell));
+		replay.events.push_back(event);
+		previous = event;
+	}
+
+	if (replay.result == Result::Unfinished)
+		replay.duration = previous.time;
+
+	return replay;
+}
+
+void Replay::appendHeader(QByteArray& out, const Replay& replay)
+{
+	out.append(MAGIC, sizeof(MAGIC));
+	out += static_cast<char>(VERSION);
+	appendVarint(out, replay.rows);
+	appendVarint(out, replay.columns);
+	appendVarint(out, replay.mines);
+	appendVarint(out, replay.firstCell);
+	appendVarint(out, static_cast<quint64>(replay.started.toMSecsSinceEpoch()));
+
+	char seed[sizeof(quint64)];
+	qToLittleEndian(replay.seed, seed);
+	out.append(seed, sizeof(seed));
+
+	appendVarint(out, replay.layout.size());
+	BoardCore::Index previous = 0;
+	for (const auto cell : replay.layout)
+	{
+		appendVarint(out, cell - previous);
+		previous = cell;
+	}
+}
+
+void Replay::appendEvent(QByteArray& out, const Event& event, const Event& previous)
+{
+	appendVarint(out, ((event.time - previous.time) << ACTION_BITS) | static_cast<quint64>(event.action));
+	appendVarint(out, zigzag(static_cast<qint64>(event.cell) - static_cast<qint64>(previous.cell)));
+}
+
+void Replay::appendEnd(QByteArray& out, Result result, quint64 time, const Event& previous)
+{
+	appendVarint(out, ((time - previous.time) << ACTION_BITS) | static_cast<quint64>(Action::End));
+	appendVarint(out, static_cast<quint64>(result));
+}
\ No newline at end of file
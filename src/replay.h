@@ -0,0 +1,127 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       replay.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `Replay` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "boardCore.h"
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QDateTime>
+
+#include <optional>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: Replay
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Everything needed to play a game again: the board, its seed and every input in order.
+/// @details The binary format is a header followed by one record per event:
+///
+///          - header: the magic `MSRP`, a version byte, then as varints the rows, columns, mines, first clicked cell
+///            and start time (ms since the epoch), the seed as 8 little-endian bytes, and the number of cells in
+///            `layout` followed by each as a varint of its distance from the one before.
+///          - event: a varint of the time since the previous event in microseconds, shifted left by 3 with the action
+///            in the low bits, then a zigzag varint of the cell relative to the previous event's cell. The first event
+///            is relative to `origin()`.
+///          - end: like an event, with the action `End` and the result in place of the cell.
+///
+///          Clicks are close together in time and space, so a typical record takes 3 to 5 bytes. A recording that
+///          stops early, say because the game crashed, still decodes up to its last complete record.
+//----------------------------------------------------------------------------------------------------------------------
+class Replay
+{
+public:
+
+	static constexpr char   MAGIC[4] = {'M', 'S', 'R', 'P'};
+	static constexpr quint8 VERSION  = 1;
+
+	enum class Action : quint8
+	{
+		Press,   ///< a mouse button went down over the cell
+		Release, ///< the buttons were released over the cell
+		Reveal,
+		Flag,
+		Chord,
+		End, ///< not an input, marks the result
+	};
+
+	enum class Result : quint8
+	{
+		Unfinished, ///< the recording stopped before the game was decided
+		Victory,
+		Defeat,
+		Forfeit,
+	};
+
+	struct Event
+	{
+		quint64          time   = 0; ///< microseconds since the first click
+		BoardCore::Index cell   = 0;
+		Action           action = Action::Press;
+	};
+
+public:
+
+	quint32                       rows      = 0;
+	quint32                       columns   = 0;
+	quint32                       mines     = 0;
+	quint64                       seed      = 0;
+	BoardCore::Index              firstCell = 0;
+	std::vector<BoardCore::Index> layout; ///< ascending mine cells of a game imported from elsewhere, else empty
+	QDateTime                     started;
+	std::vector<Event>            events;
+	Result                        result   = Result::Unfinished;
+	quint64                       duration = 0; ///< microseconds from the first click to the end of the game
+
+public:
+
+	/// the mines of this game: the recorded layout, or the ones the seed and first click produce
+	void placeMines(BoardCore& core) const;
+
+	/// what the first event is encoded relative to: the first click of a game of our own, which is usually where the
+	/// first event is, and cell 0 of an imported one
+	[[nodiscard]] Event origin() const noexcept { return {0, layout.empty() ? firstCell : 0, Action::Press}; }
+
+	[[nodiscard]] QByteArray                   encode() const;
+	[[nodiscard]] static std::optional<Replay> decode(QByteArrayView data);
+
+	/// the pieces of `encode()`, for writing a replay while it is being played
+	static void appendHeader(QByteArray& out, const Replay& replay);
+	static void appendEvent(QByteArray& out, const Event& event, const Event& previous);
+	static void appendEnd(QByteArray& out, Result result, quint64 time, const Event& previous);
+};
+
+#endif // REPLAY_H
\ No newline at end of file
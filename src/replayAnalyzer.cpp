@@ -0,0 +1,259 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       replayAnalyzer.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `replayAnalyzer.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "replayAnalyzer.h"
+#include "boardSolver.h"
+#include "trace.h"
+
+#include <QElapsedTimer>
+#include <QTextStream>
+#include <QtConcurrent>
+
+#include <numeric>
+
+//----------------------------
+//  LOCAL DEFINITIONS
+//----------------------------
+
+namespace
+{
+	/// this close to certain, a move is judged as if it were
+	constexpr double CERTAIN = 1e-9;
+
+	ReplayAnalyzer::Verdict verdict(double safety)
+	{
+		if (safety >= 1.0 - CERTAIN)
+			return ReplayAnalyzer::Verdict::Forced;
+		if (safety <= CERTAIN)
+			return ReplayAnalyzer::Verdict::Mistake;
+		return ReplayAnalyzer::Verdict::Guess;
+	}
+} // namespace
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+double ReplayAnalyzer::Analysis::threeBVPerSecond() const noexcept
+{
+	return duration ? solvedThreeBV * 1e6 / static_cast<double>(duration) : 0.0;
+}
+
+double ReplayAnalyzer::Analysis::clicksPerThreeBV() const noexcept
+{
+	return solvedThreeBV ? static_cast<double>(clicks()) / solvedThreeBV : 0.0;
+}
+
+double ReplayAnalyzer::Analysis::efficiency() const noexcept
+{
+	return clicks() ? 100.0 * solvedThreeBV / clicks() : 0.0;
+}
+
+void ReplayAnalyzer::Summary::add(const Analysis& analysis)
+{
+	++games;
+	if (analysis.result == Replay::Result::Victory)
+	{
+		++victories;
+		threeBVPerSecond += analysis.threeBVPerSecond();
+	}
+	solvedThreeBV += analysis.solvedThreeBV;
+	clicks += analysis.clicks();
+	guesses += analysis.guesses;
+	guessesSurvived += analysis.guessesSurvived;
+	guessTime += analysis.guessTime;
+	mistakes += analysis.mistakes;
+}
+
+double ReplayAnalyzer::Summary::averageThreeBVPerSecond() const noexcept { return victories ? threeBVPerSecond / victories : 0.0; }
+
+double ReplayAnalyzer::Summary::efficiency() const noexcept { return clicks ? 100.0 * solvedThreeBV / clicks : 0.0; }
+
+double ReplayAnalyzer::Summary::guessesPerGame() const noexcept { return games ? static_cast<double>(guesses) / games : 0.0; }
+
+double ReplayAnalyzer::Summary::guessSuccessRate() const noexcept { return guesses ? 100.0 * guessesSurvived / guesses : 0.0; }
+
+double ReplayAnalyzer::Summary::timePerGuess() const noexcept { return guesses ? guessTime / 1e6 / guesses : 0.0; }
+
+double ReplayAnalyzer::Summary::mistakesPerGame() const noexcept { return games ? static_cast<double>(mistakes) / games : 0.0; }
+
+std::optional<ReplayAnalyzer::Analysis> ReplayAnalyzer::analyze(const Replay& replay)
+{
+	TRACE_SCOPE("ReplayAnalyzer::analyze");
+
+	Analysis analysis;
+	analysis.size     = {replay.rows, replay.columns, replay.mines};
+	analysis.result   = replay.result;
+	analysis.duration = replay.duration;
+	if (!analysis.size.isValid() || replay.firstCell >= analysis.size.cellCount())
+		return std::nullopt;
+
+	BoardCore core(replay.rows, replay.columns, replay.mines);
+	replay.placeMines(core);
+	analysis.threeBV = core.metrics().threeBV;
+
+	BoardSolver solver(core);
+	auto        mineProbability = [&](BoardCore::Index cell)
+	{
+		const double probability = solver.mineProbability(cell);
+		analysis.exact &= solver.exact();
+		return probability;
+	};
+
+	// our own games keep the first click and its neighbors clear, imported ones make no such promise
+	bool    firstReveal = replay.layout.empty();
+	quint64 previous    = 0;
+	for (const auto& event : replay.events)
+	{
+		if (event.action == Replay::Action::Press || event.action == Replay::Action::Release)
+			continue;
+		if (event.cell >= core.cellCount() || core.state() != BoardCore::State::InProgress)
+			break;
+
+		Move move;
+		move.time      = event.time;
+		move.thinkTime = event.time - std::min(previous, event.time);
+		move.cell      = event.cell;
+		move.action    = event.action;
+		previous       = event.time;
+
+		// how likely the move was right, before it is made
+		switch (event.action)
+		{
+		case Replay::Action::Reveal:
+			move.safety = firstReveal ? 1.0 : 1.0 - mineProbability(event.cell);
+			break;
+		case Replay::Action::Flag:
+			move.safety = core.isFlagged(event.cell) ? 1.0 - mineProbability(event.cell) : mineProbability(event.cell);
+			break;
+		case Replay::Action::Chord:
+			// the cells a chord opens are taken as independent, which is close enough to rank the move
+			if (core.isRevealed(event.cell) && core.adjacentFlags(event.cell) == core.adjacentMines(event.cell))
+			{
+				core.forEachNeighbor(event.cell,
+									 [&](BoardCore::Index neighbor)
+									 {
+										 if (!core.isRevealed(neighbor) && !core.isFlagged(neighbor))
+											 move.safety *= 1.0 - mineProbability(neighbor);
+									 });
+			}
+			break;
+		default:
+			break;
+		}
+		move.verdict = verdict(move.safety);
+
+		switch (event.action)
+		{
+		case Replay::Action::Reveal:
+			core.reveal(event.cell);
+			break;
+		case Replay::Action::Flag:
+			core.toggleFlag(event.cell);
+			break;
+		case Replay::Action::Chord:
+			core.chord(event.cell);
+			break;
+		default:
+			break;
+		}
+
+		if (core.changedCells().empty() && !core.changesOverflowed())
+		{
+			move.verdict = Verdict::Wasted;
+			move.safety  = 1.0;
+		}
+		else if (event.action == Replay::Action::Reveal)
+			firstReveal = false;
+
+		switch (move.verdict)
+		{
+		case Verdict::Forced:
+			++analysis.forced;
+			break;
+		case Verdict::Guess:
+			++analysis.guesses;
+			analysis.guessesSurvived += core.state() != BoardCore::State::Defeat;
+			analysis.guessTime += move.thinkTime;
+			break;
+		case Verdict::Mistake:
+			++analysis.mistakes;
+			break;
+		case Verdict::Wasted:
+			++analysis.wasted;
+			break;
+		}
+		analysis.moves.push_back(move);
+
+		solver.update();
+		core.clearChanges();
+	}
+
+	analysis.solvedThreeBV = core.metrics().solvedThreeBV;
+	return analysis;
+}
+
+QFuture<ReplayAnalyzer::Summaries> ReplayAnalyzer::summarize(const ReplayArchive& archive)
+{
+	// each game is analyzed on its own thread, and only its summary is kept
+	QList<qsizetype> indices(archive.size());
+	std::iota(indices.begin(), indices.end(), 0);
+	return QtConcurrent::mappedReduced<Summaries>(
+		std::move(indices),
+		[&archive](qsizetype index)
+		{
+			const auto replay = archive.replay(index);
+			return replay ? analyze(*replay) : std::nullopt;
+		},
+		[](Summaries& summaries, const std::optional<Analysis>& analysis)
+		{
+			if (analysis)
+				summaries[analysis->size].add(*analysis);
+		});
+}
+
+int ReplayAnalyzer::run(const QString& directory)
+{
+	QTextStream out(stdout);
+
+	const ReplayArchive archive(directory);
+	if (!archive.isOpen())
+	{
+		out << "Unable to open the replay archive in " << directory << Qt::endl;
+		return 1;
+	}
+
+	QElapsedTimer timer;
+	timer.start();
+	const Summaries summaries = summarize(archive).result();
+	const qint64    elapsedMs = timer.elapsed();
+
+	for (auto it = summaries.begin(); it != summaries.end(); ++it)
+	{
+		const Summary& summary = it.value();
+		out << it.key().name() << ": " << summary.games << " games, " << summary.victories << " won, " << QString::number(summary.averageThreeBVPerSecond(), 'f', 2)
+			<< " 3BV/s, " << QString::number(summary.efficiency(), 'f', 1) << "% efficiency, " << QString::number(summary.guessesPerGame(), 'f', 2)
+			<< " guesses per game (" << QString::number(summary.guessSuccessRate(), 'f', 1) << "% survived, "
+			<< QString::number(summary.timePerGuess(), 'f', 2) << " s each), " << QString::number(summary.mistakesPerGame(), 'f', 2) << " mistakes per game"
+			<< Qt::endl;
+	}
+
+	out << "Analyzed " << archive.size() << " replays in " << elapsedMs << " ms" << Qt::endl;
+	return 0;
+}
\ No newline at end of file
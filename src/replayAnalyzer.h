@@ -0,0 +1,144 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       replayAnalyzer.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `ReplayAnalyzer` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef REPLAYANALYZER_H
+#define REPLAYANALYZER_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "boardSize.h"
+#include "replay.h"
+#include "replayArchive.h"
+
+#include <QFuture>
+#include <QMap>
+#include <QString>
+
+#include <optional>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: ReplayAnalyzer
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Judges every move of a recorded game against what could be known when it was made.
+/// @details The game is played again on a board core, with a `BoardSolver` following along that sees only what the
+///          player saw. Before each move the solver says how likely the cells the move touches are mines: a move
+///          that was certain to be right was forced, one that was certain to be wrong is a mistake, anything between
+///          is a guess with that chance of success. A move that changed nothing is wasted.
+///
+///          From the moves come the usual measures of skill: the 3BV of the board (the fewest clicks that clear it),
+///          3BV/s, clicks per 3BV and efficiency, which, unlike the time alone, compare across boards. The solver
+///          state carries from move to move, so a game costs little more than playing it, and an archive is analyzed
+///          one game per thread.
+//----------------------------------------------------------------------------------------------------------------------
+class ReplayAnalyzer
+{
+public:
+
+	enum class Verdict : quint8
+	{
+		Forced,
+		Guess,
+		Mistake,
+		Wasted, ///< the move changed nothing
+	};
+
+	struct Move
+	{
+		quint64          time      = 0; ///< microseconds since the first click
+		quint64          thinkTime = 0; ///< microseconds since the move before
+		BoardCore::Index cell      = 0;
+		Replay::Action   action    = Replay::Action::Reveal;
+		Verdict          verdict   = Verdict::Forced;
+		double           safety    = 1.0; ///< the chance the move was right when it was made
+	};
+
+	struct Analysis
+	{
+		BoardSize         size;
+		Replay::Result    result   = Replay::Result::Unfinished;
+		quint64           duration = 0; ///< microseconds
+		std::vector<Move> moves;
+		bool              exact = true; ///< false if a probability had to be estimated
+
+		quint32 threeBV         = 0;
+		quint32 solvedThreeBV   = 0; ///< of the 3BV, what was cleared by the end
+		quint32 forced          = 0;
+		quint32 guesses         = 0;
+		quint32 guessesSurvived = 0;
+		quint32 mistakes        = 0;
+		quint32 wasted          = 0;
+		quint64 guessTime       = 0; ///< microseconds spent before guesses
+
+		[[nodiscard]] quint32 clicks() const noexcept { return static_cast<quint32>(moves.size()); }
+		[[nodiscard]] double  threeBVPerSecond() const noexcept;
+		[[nodiscard]] double  clicksPerThreeBV() const noexcept;
+		[[nodiscard]] double  efficiency() const noexcept; ///< solved 3BV per click, in percent
+	};
+
+	/// the analyses of many games on one board size, added up
+	struct Summary
+	{
+		qsizetype games            = 0;
+		qsizetype victories        = 0;
+		double    threeBVPerSecond = 0.0; ///< summed over the victories
+		quint64   solvedThreeBV    = 0;
+		quint64   clicks           = 0;
+		quint64   guesses          = 0;
+		quint64   guessesSurvived  = 0;
+		quint64   guessTime        = 0;
+		quint64   mistakes         = 0;
+
+		void add(const Analysis& analysis);
+
+		[[nodiscard]] double averageThreeBVPerSecond() const noexcept;
+		[[nodiscard]] double efficiency() const noexcept; ///< in percent
+		[[nodiscard]] double guessesPerGame() const noexcept;
+		[[nodiscard]] double guessSuccessRate() const noexcept; ///< in percent
+		[[nodiscard]] double timePerGuess() const noexcept;     ///< in seconds
+		[[nodiscard]] double mistakesPerGame() const noexcept;
+	};
+
+	using Summaries = QMap<BoardSize, Summary>;
+
+public:
+
+	[[nodiscard]] static std::optional<Analysis> analyze(const Replay& replay);
+
+	/// analyzes every replay in `archive` on the global thread pool. The archive must outlive the future.
+	[[nodiscard]] static QFuture<Summaries> summarize(const ReplayArchive& archive);
+
+	/// analyzes the archive in `directory` and prints the summary, for `minesweeper --analyze-replays [directory]`
+	static int run(const QString& directory);
+};
+
+#endif // REPLAYANALYZER_H
\ No newline at end of file
@@ -0,0 +1,164 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       replayArchive.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `replayArchive.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "replayArchive.h"
+#include "trace.h"
+
+#include <QDir>
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+ReplayArchive::ReplayArchive(const QString& directory)
+	: m_directory(directory)
+{
+	TRACE_SCOPE("ReplayArchive::ReplayArchive");
+
+	if (!QDir().mkpath(directory))
+		return;
+
+	m_segment.setFileName(QDir(directory).filePath(SEGMENT_FILE_NAME));
+	m_index.setFileName(QDir(directory).filePath(INDEX_FILE_NAME));
+	if (!m_segment.open(QIODevice::ReadWrite) || !m_index.open(QIODevice::ReadWrite))
+	{
+		m_segment.close();
+		m_index.close();
+		return;
+	}
+
+	// a crash in the middle of writing an entry leaves part of it behind
+	if (const qint64 partial = m_index.size() % static_cast<qint64>(sizeof(Entry)))
+		m_index.resize(m_index.size() - partial);
+
+	map();
+}
+
+ReplayArchive::~ReplayArchive()
+{
+	unmap();
+}
+
+bool ReplayArchive::append(QByteArrayView replay)
+{
+	TRACE_SCOPE("ReplayArchive::append");
+
+	const auto decoded = Replay::decode(replay);
+	if (!isOpen() || !decoded)
+		return false;
+
+	Entry entry{};
+	entry.seed     = decoded->seed;
+	entry.started  = decoded->started.toMSecsSinceEpoch();
+	entry.duration = decoded->duration;
+	entry.length   = static_cast<quint32>(replay.size());
+	entry.rows     = decoded->rows;
+	entry.columns  = decoded->columns;
+	entry.mines    = decoded->mines;
+	entry.result   = static_cast<quint8>(decoded->result);
+
+	// the files only grow while nothing is mapped, which is what every platform is happy with. Readers on other
+	// threads finish the replay they are on first.
+	std::unique_lock lock(m_mutex);
+	unmap();
+
+	const qint64 segmentEnd = m_segment.size();
+	entry.offset            = static_cast<quint64>(segmentEnd) + sizeof(entry.length);
+
+	const bool written = m_segment.seek(segmentEnd) &&
+						 m_segment.write(reinterpret_cast<const char*>(&entry.length), sizeof(entry.length)) == sizeof(entry.length) &&
+						 m_segment.write(replay.data(), replay.size()) == replay.size() && m_segment.flush() && m_index.seek(m_index.size()) &&
+						 m_index.write(reinterpret_cast<const char*>(&entry), sizeof(entry)) == sizeof(entry) && m_index.flush();
+
+	map();
+	return written;
+}
+
+QByteArrayView ReplayArchive::data(qsizetype index) const
+{
+	if (index < 0 || index >= size())
+		return {};
+
+	// an index that points past the segment is damaged, not something to read through
+	const Entry& entry = m_entries[index];
+	if (entry.offset + entry.length > static_cast<quint64>(m_segmentSize))
+		return {};
+
+	return QByteArrayView(reinterpret_cast<const char*>(m_segmentData + entry.offset), entry.length);
+}
+
+std::optional<Replay> ReplayArchive::replay(qsizetype index) const
+{
+	std::shared_lock     lock(m_mutex);
+	const QByteArrayView bytes = data(index);
+	if (bytes.isEmpty())
+		return std::nullopt;
+
+	return Replay::decode(bytes);
+}
+
+qsizetype ReplayArchive::latest(const BoardSize& size) const
+{
+	for (qsizetype index = this->size() - 1; index >= 0; --index)
+	{
+		if (m_entries[index].boardSize() == size)
+			return index;
+	}
+	return -1;
+}
+
+qsizetype ReplayArchive::findVictory(const BoardSize& size, quint32 milliseconds, const QDateTime& scored) const
+{
+	// the score is the game clock, which runs from the first click like the recording, and it is entered after the
+	// game. Older scores only kept whole seconds, so anything within one of them matches.
+	for (qsizetype index = this->size() - 1; index >= 0; --index)
+	{
+		const Entry&  entry   = m_entries[index];
+		const quint64 elapsed = entry.duration / 1'000;
+		if (entry.replayResult() == Replay::Result::Victory && entry.boardSize() == size && entry.started <= scored.toMSecsSinceEpoch() &&
+			elapsed + 1'000 >= milliseconds && elapsed <= static_cast<quint64>(milliseconds) + 1'000)
+			return index;
+	}
+	return -1;
+}
+
+void ReplayArchive::map()
+{
+	m_segmentSize = m_segment.size();
+	m_segmentData = m_segmentSize ? m_segment.map(0, m_segmentSize) : nullptr;
+	if (!m_segmentData)
+		m_segmentSize = 0;
+
+	const qint64 indexSize = m_index.size();
+	const uchar* index     = indexSize ? m_index.map(0, indexSize) : nullptr;
+	m_entries              = index ? std::span<const Entry>(reinterpret_cast<const Entry*>(index), static_cast<size_t>(indexSize) / sizeof(Entry))
+								   : std::span<const Entry>();
+}
+
+void ReplayArchive::unmap()
+{
+	if (m_segmentData)
+		m_segment.unmap(const_cast<uchar*>(m_segmentData));
+	if (!m_entries.empty())
+		m_index.unmap(reinterpret_cast<uchar*>(const_cast<Entry*>(m_entries.data())));
+
+	m_segmentData = nullptr;
+	m_segmentSize = 0;
+	m_entries     = {};
+}
\ No newline at end of file
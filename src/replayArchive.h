@@ -0,0 +1,136 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       replayArchive.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `ReplayArchive` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef REPLAYARCHIVE_H
+#define REPLAYARCHIVE_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "boardSize.h"
+#include "replay.h"
+
+#include <QByteArrayView>
+#include <QDateTime>
+#include <QFile>
+#include <QString>
+
+#include <optional>
+#include <shared_mutex>
+#include <span>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: ReplayArchive
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Append-only store of every recorded game, read through memory maps.
+/// @details Two files in one directory:
+///
+///          - `replays.segment`: the encoded replays back to back, each preceded by its length as a 32-bit integer.
+///          - `replays.index`: one fixed-size `Entry` per replay, with its position in the segment and what a search
+///            needs without decoding it: the date, board size, result, duration and seed.
+///
+///          Both files are mapped, so scanning the index or handing out a replay is a pointer into the page cache
+///          rather than a copy. The segment is written before the index, so a crash between the two leaves at most
+///          an unindexed replay at the end of the segment, and a partial index entry is dropped on open. The files
+///          use the byte order of the machine, which is little-endian on every platform the game ships on.
+///
+///          `replay()` may be called from worker threads while the owning thread appends. An append remaps the files,
+///          so it waits for the replays being decoded, and the views `data()` hands out last only until the next one.
+//----------------------------------------------------------------------------------------------------------------------
+class ReplayArchive
+{
+public:
+
+	static constexpr const char* SEGMENT_FILE_NAME = "replays.segment";
+	static constexpr const char* INDEX_FILE_NAME   = "replays.index";
+
+	struct Entry
+	{
+		quint64 offset;   ///< of the encoded replay in the segment, past its length
+		quint64 seed;
+		qint64  started;  ///< ms since the epoch
+		quint64 duration; ///< us
+		quint32 length;   ///< of the encoded replay
+		quint32 rows;
+		quint32 columns;
+		quint32 mines;
+		quint8  result; ///< a `Replay::Result`
+		quint8  reserved[7];
+
+		[[nodiscard]] BoardSize      boardSize() const { return {rows, columns, mines}; }
+		[[nodiscard]] Replay::Result replayResult() const { return static_cast<Replay::Result>(result); }
+	};
+	static_assert(sizeof(Entry) == 56, "the index is read in place, its layout must not change");
+
+public:
+
+	explicit ReplayArchive(const QString& directory);
+	~ReplayArchive();
+
+	ReplayArchive(const ReplayArchive&)            = delete;
+	ReplayArchive& operator=(const ReplayArchive&) = delete;
+
+	[[nodiscard]] const QString& directory() const noexcept { return m_directory; }
+	[[nodiscard]] bool           isOpen() const noexcept { return m_segment.isOpen() && m_index.isOpen(); }
+
+	/// adds an encoded replay, see `Replay::encode()`
+	bool append(QByteArrayView replay);
+
+	[[nodiscard]] qsizetype              size() const noexcept { return static_cast<qsizetype>(m_entries.size()); }
+	[[nodiscard]] std::span<const Entry> entries() const noexcept { return m_entries; }
+	[[nodiscard]] QByteArrayView         data(qsizetype index) const; ///< valid until the next `append()`
+	[[nodiscard]] std::optional<Replay>  replay(qsizetype index) const;
+
+	/// the most recent game on a board of `size`, or -1
+	[[nodiscard]] qsizetype latest(const BoardSize& size) const;
+
+	/// the won game a high score of `milliseconds` on `size`, entered at `scored`, came from, or -1
+	[[nodiscard]] qsizetype findVictory(const BoardSize& size, quint32 milliseconds, const QDateTime& scored) const;
+
+private:
+
+	void map();
+	void unmap();
+
+private:
+
+	QString m_directory;
+	QFile   m_segment;
+	QFile   m_index;
+
+	mutable std::shared_mutex m_mutex; ///< held shared while a replay is read from the mapping, exclusive to remap it
+
+	const uchar*           m_segmentData = nullptr;
+	qint64                 m_segmentSize = 0;
+	std::span<const Entry> m_entries;
+};
+
+#endif // REPLAYARCHIVE_H
\ No newline at end of file
@@ -0,0 +1,159 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       replayEngine.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `replayEngine.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "replayEngine.h"
+#include "boardSize.h"
+#include "trace.h"
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTextStream>
+#include <QtConcurrent>
+
+#include <numeric>
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+ReplayEngine::Verification ReplayEngine::verify(const Replay& replay)
+{
+	TRACE_SCOPE("ReplayEngine::verify");
+
+	Verification verification;
+	verification.result = replay.result;
+
+	auto fail = [&verification](const QString& error)
+	{
+		verification.error = error;
+		return verification;
+	};
+
+	const BoardSize size{replay.rows, replay.columns, replay.mines};
+	if (!size.isValid() || replay.firstCell >= size.cellCount())
+		return fail(QObject::tr("invalid board"));
+
+	BoardCore core(replay.rows, replay.columns, replay.mines);
+	replay.placeMines(core);
+
+	// the board ignores input once a game is decided, so a recording never holds actions after its end
+	for (const auto& event : replay.events)
+	{
+		if (event.cell >= core.cellCount())
+			return fail(QObject::tr("action outside the board"));
+
+		const bool input = event.action == Replay::Action::Press || event.action == Replay::Action::Release;
+		if (!input && core.state() != BoardCore::State::InProgress)
+			return fail(QObject::tr("action after the end of the game"));
+
+		switch (event.action)
+		{
+		case Replay::Action::Reveal:
+			core.reveal(event.cell);
+			break;
+		case Replay::Action::Flag:
+			core.toggleFlag(event.cell);
+			break;
+		case Replay::Action::Chord:
+			core.chord(event.cell);
+			break;
+		default:
+			break;
+		}
+		core.clearChanges();
+	}
+
+	const bool consistent = [&]
+	{
+		switch (replay.result)
+		{
+		case Replay::Result::Victory:
+			return core.state() == BoardCore::State::Victory;
+		case Replay::Result::Defeat:
+			return core.state() == BoardCore::State::Defeat;
+		default:
+			return core.state() == BoardCore::State::InProgress;
+		}
+	}();
+	if (!consistent)
+		return fail(QObject::tr("result does not match the recorded actions"));
+
+	// a decided game ends with the action that decided it, so the recorded time can only trail it by a moment
+	const quint64 lastAction = replay.events.empty() ? 0 : replay.events.back().time;
+	if (replay.duration < lastAction)
+		return fail(QObject::tr("ends before its last action"));
+	if ((replay.result == Replay::Result::Victory || replay.result == Replay::Result::Defeat) && replay.duration - lastAction > MAX_END_LAG_US)
+		return fail(QObject::tr("recorded time does not match the recorded actions"));
+
+	verification.valid    = true;
+	verification.duration = replay.duration;
+	return verification;
+}
+
+ReplayEngine::Verification ReplayEngine::verify(const ReplayArchive& archive, qsizetype index)
+{
+	Verification verification;
+	if (const auto replay = archive.replay(index))
+		verification = verify(*replay);
+	else
+		verification.error = QObject::tr("not a replay");
+
+	verification.index = index;
+	return verification;
+}
+
+QFuture<ReplayEngine::Verification> ReplayEngine::verifyAll(const ReplayArchive& archive)
+{
+	// each replay is decoded straight out of the mapped segment on its own thread
+	QList<qsizetype> indices(archive.size());
+	std::iota(indices.begin(), indices.end(), 0);
+	return QtConcurrent::mapped(std::move(indices), [&archive](qsizetype index) { return verify(archive, index); });
+}
+
+int ReplayEngine::run(const QString& directory)
+{
+	QTextStream out(stdout);
+
+	const ReplayArchive archive(directory);
+	if (!archive.isOpen())
+	{
+		out << "Unable to open the replay archive in " << directory << Qt::endl;
+		return 1;
+	}
+
+	QElapsedTimer timer;
+	timer.start();
+	const QList<Verification> verifications = verifyAll(archive).results();
+	const qint64              elapsedMs     = timer.elapsed();
+
+	int failed = 0;
+	for (const auto& verification : verifications)
+	{
+		if (verification.valid)
+			continue;
+
+		const auto& entry = archive.entries()[verification.index];
+		out << "replay " << verification.index << " (" << QDateTime::fromMSecsSinceEpoch(entry.started).toString(Qt::ISODate) << ", "
+			<< entry.boardSize().name() << "): " << verification.error << Qt::endl;
+		++failed;
+	}
+
+	out << "Verified " << verifications.size() << " replays in " << elapsedMs << " ms, " << failed << " invalid" << Qt::endl;
+	return failed ? 1 : 0;
+}
\ No newline at end of file
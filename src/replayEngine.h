@@ -0,0 +1,81 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       replayEngine.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `ReplayEngine` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef REPLAYENGINE_H
+#define REPLAYENGINE_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "replay.h"
+#include "replayArchive.h"
+
+#include <QFuture>
+#include <QString>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: ReplayEngine
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Re-executes recorded games against the board core, without a view and as fast as the core runs.
+/// @details The core places its mines from the recorded seed and first click. Playing the recorded actions back must
+///          therefore reach exactly the recorded result, at a time consistent with the recorded duration. Anything
+///          else means the replay, or the score it backs, was not produced by the game. Verification only needs a
+///          core per replay, so bulk verification runs one replay per thread across all cores.
+//----------------------------------------------------------------------------------------------------------------------
+class ReplayEngine
+{
+public:
+
+	/// the recorded end of a game can't lag its last action by more than this
+	static constexpr quint64 MAX_END_LAG_US = 1'000'000;
+
+	struct Verification
+	{
+		qsizetype      index = -1; ///< of the replay in its archive, if any
+		bool           valid = false;
+		QString        error; ///< why the replay is not valid
+		Replay::Result result   = Replay::Result::Unfinished;
+		quint64        duration = 0; ///< verified time from the first click to the end, in microseconds
+	};
+
+public:
+
+	[[nodiscard]] static Verification verify(const Replay& replay);
+	[[nodiscard]] static Verification verify(const ReplayArchive& archive, qsizetype index);
+
+	/// verifies every replay in `archive` on the global thread pool. The archive must outlive the future.
+	[[nodiscard]] static QFuture<Verification> verifyAll(const ReplayArchive& archive);
+
+	/// verifies the archive in `directory` and prints a summary, for `minesweeper --verify-replays [directory]`
+	static int run(const QString& directory);
+};
+
+#endif // REPLAYENGINE_H
\ No newline at end of file
@@ -0,0 +1,631 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       replayImport.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `replayImport.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "replayImport.h"
+#include "boardSize.h"
+#include "replayArchive.h"
+#include "trace.h"
+
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QObject>
+#include <QTextStream>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <array>
+
+//----------------------------
+//  LOCAL DEFINITIONS
+//----------------------------
+
+namespace
+{
+	constexpr qsizetype BUFFER_SIZE = 16 * 1024;
+	constexpr qsizetype MAX_HEADER  = 64 * 1024; ///< how far to look for the end of a text header
+
+	/// big-endian reads through a fixed buffer. Like the reader of our own replays, it stays put once the file runs
+	/// out and remembers that it did, so a format reader checks `ok()` once per record instead of once per field.
+	class Stream
+	{
+	public:
+
+		explicit Stream(QIODevice& device)
+			: m_device(device)
+		{
+		}
+
+		[[nodiscard]] bool   ok() const noexcept { return m_ok; }
+		[[nodiscard]] qint64 position() const noexcept { return m_consumed + m_position; }
+
+		quint8 u8()
+		{
+			if (m_position == m_size && !fill())
+				return 0;
+			return static_cast<quint8>(m_buffer[m_position++]);
+		}
+
+		quint16 u16()
+		{
+			const quint16 high = u8();
+			return static_cast<quint16>(high << 8 | u8());
+		}
+
+		quint32 u24()
+		{
+			const quint32 high = u16();
+			return high << 8 | u8();
+		}
+
+		quint32 u32()
+		{
+			const quint32 high = u16();
+			return high << 16 | u16();
+		}
+
+		void skip(qint64 count)
+		{
+			while (count > 0 && m_ok)
+			{
+				if (m_position == m_size && !fill())
+					return;
+				const qint64 step = std::min<qint64>(count, m_size - m_position);
+				m_position += step;
+				count -= step;
+			}
+		}
+
+		/// moves past the next occurrence of `marker`, looking no further than `MAX_HEADER` bytes
+		bool skipPast(QByteArrayView marker)
+		{
+			qsizetype matched = 0;
+			for (qsizetype scanned = 0; scanned < MAX_HEADER && m_ok; ++scanned)
+			{
+				const char byte = static_cast<char>(u8());
+				matched         = byte == marker[matched] ? matched + 1 : (byte == marker[0] ? 1 : 0);
+				if (matched == marker.size())
+					return m_ok;
+			}
+			m_ok = false;
+			return false;
+		}
+
+	private:
+
+		bool fill()
+		{
+			m_consumed += m_size;
+			m_position = 0;
+			m_size     = m_ok ? std::max<qint64>(m_device.read(m_buffer.data(), BUFFER_SIZE), 0) : 0;
+			m_ok       = m_size > 0;
+			return m_ok;
+		}
+
+	private:
+
+		QIODevice&                    m_device;
+		std::array<char, BUFFER_SIZE> m_buffer;
+		qint64                        m_size     = 0;
+		qint64                        m_position = 0;
+		qint64                        m_consumed = 0;
+		bool                          m_ok       = true;
+	};
+
+	/// plays raw mouse input against a board with the recorded layout, the way the original Windows game interprets
+	/// it, and records the actions that result
+	class Mouse
+	{
+	public:
+
+		enum Button : quint8
+		{
+			Left   = 0x1,
+			Right  = 0x2,
+			Middle = 0x4,
+		};
+
+		explicit Mouse(Replay& replay)
+			: m_replay(replay)
+			, m_core(replay.rows, replay.columns, replay.mines)
+		{
+			replay.placeMines(m_core);
+		}
+
+		[[nodiscard]] bool decided() const noexcept { return m_core.state() != BoardCore::State::InProgress; }
+
+		void press(Button button, quint64 time, qint64 x, qint64 y)
+		{
+			if (decided() || (m_buttons & button))
+				return;
+
+			const BoardCore::Index cell = cellAt(x, y);
+			m_buttons |= button;
+			record(Replay::Action::Press, time, cell);
+
+			// both buttons, or the middle one, chord on release. A right click alone flags as soon as it goes down.
+			if (button == Middle || (m_buttons & (Left | Right)) == (Left | Right))
+				m_chording = true;
+			else if (button == Right && cell != BoardCore::NoCell && !m_core.isRevealed(cell))
+			{
+				record(Replay::Action::Flag, time, cell);
+				m_core.toggleFlag(cell);
+			}
+		}
+
+		void release(Button button, quint64 time, qint64 x, qint64 y)
+		{
+			// a release whose press came before the recording started does nothing
+			if (decided() || !(m_buttons & button))
+				return;
+
+			const BoardCore::Index cell = cellAt(x, y);
+			m_buttons &= ~button;
+			record(Replay::Action::Release, time, cell);
+
+			if (cell != BoardCore::NoCell)
+			{
+				// the first button up ends a chord, the other one is released without effect
+				if (m_chording && !m_chorded && m_core.isRevealed(cell))
+				{
+					record(Replay::Action::Chord, time, cell);
+					m_core.chord(cell);
+				}
+				else if (!m_chording && button == Left && !m_core.isRevealed(cell) && !m_core.isFlagged(cell))
+				{
+					if (!m_revealed)
+						m_replay.firstCell = cell;
+					m_revealed = true;
+					record(Replay::Action::Reveal, time, cell);
+					m_core.reveal(cell);
+				}
+			}
+			m_chorded = m_chording;
+			if (!m_buttons)
+				m_chording = m_chorded = false;
+		}
+
+		/// for formats that record which buttons are down rather than which changed
+		void setButtons(quint8 buttons, quint64 time, qint64 x, qint64 y)
+		{
+			for (const Button button : {Left, Right, Middle})
+			{
+				if ((buttons & button) && !(m_buttons & button))
+					press(button, time, x, y);
+				else if (!(buttons & button) && (m_buttons & button))
+					release(button, time, x, y);
+			}
+		}
+
+		/// the replay's clock starts with its first input, and its result is whatever the board came to
+		void finish()
+		{
+			const quint64 start = m_replay.events.empty() ? 0 : m_replay.events.front().time;
+			for (auto& event : m_replay.events)
+				event.time -= start;
+
+			m_replay.duration = m_replay.events.empty() ? 0 : m_replay.events.back().time;
+			switch (m_core.state())
+			{
+			case BoardCore::State::Victory:
+				m_replay.result = Replay::Result::Victory;
+				break;
+			case BoardCore::State::Defeat:
+				m_replay.result = Replay::Result::Defeat;
+				break;
+			default:
+				m_replay.result = Replay::Result::Unfinished;
+				break;
+			}
+		}
+
+	private:
+
+		[[nodiscard]] BoardCore::Index cellAt(qint64 x, qint64 y) const noexcept
+		{
+			if (x < 0 || y < 0)
+				return BoardCore::NoCell;
+
+			const qint64 row    = y / ReplayImport::SQUARE_SIZE;
+			const qint64 column = x / ReplayImport::SQUARE_SIZE;
+			if (row >= m_core.rows() || column >= m_core.columns())
+				return BoardCore::NoCell;
+			return m_core.index(static_cast<quint32>(row), static_cast<quint32>(column));
+		}
+
+		void record(Replay::Action action, quint64 time, BoardCore::Index cell)
+		{
+			// input outside the board, on the face or the counters, doesn't touch the game
+			if (cell == BoardCore::NoCell)
+				return;
+
+			// clocks of a few formats only count whole seconds and hundredths, so two records can share a time, but
+			// never go backwards
+			if (!m_replay.events.empty())
+				time = std::max(time, m_replay.events.back().time);
+			m_replay.events.push_back({time, cell, action});
+		}
+
+	private:
+
+		Replay&   m_replay;
+		BoardCore m_core;
+		quint8    m_buttons  = 0;
+		bool      m_chording = false;
+		bool      m_chorded  = false;
+		bool      m_revealed = false;
+	};
+
+	/// reads `count` mines as (row, column) or (column, row) byte pairs, with coordinates starting at `base`
+	bool readLayout(Stream& stream, Replay& replay, quint32 count, bool rowFirst, quint8 base)
+	{
+		const BoardSize size{replay.rows, replay.columns, count};
+		if (!size.isValid())
+			return false;
+
+		replay.layout.clear();
+		replay.layout.reserve(count);
+		for (quint32 mine = 0; mine < count; ++mine)
+		{
+			const quint8 first  = stream.u8();
+			const quint8 second = stream.u8();
+			const qint64 row    = static_cast<qint64>(rowFirst ? first : second) - base;
+			const qint64 column = static_cast<qint64>(rowFirst ? second : first) - base;
+			if (!stream.ok() || row < 0 || column < 0 || row >= replay.rows || column >= replay.columns)
+				return false;
+			replay.layout.push_back(static_cast<BoardCore::Index>(row * replay.columns + column));
+		}
+
+		std::sort(replay.layout.begin(), replay.layout.end());
+		replay.layout.erase(std::unique(replay.layout.begin(), replay.layout.end()), replay.layout.end());
+		replay.mines = static_cast<quint32>(replay.layout.size());
+		return true;
+	}
+
+	/// Minesweeper Arbiter: a version byte and four unused ones, the level (3 beginner, 4 intermediate, 5 expert or 6
+	/// custom, which is followed by the columns - 1, the rows - 1 and a 16-bit mine count), then each mine as a 1-based
+	/// row and column. A text header follows up to the marker `cs=` and the 17 bytes after it. Then come 8-byte mouse
+	/// records, each a set of button transitions, the position in pixels and the time in seconds and hundredths split
+	/// over the record, up to one with a time of zero.
+	QString readArbiter(Stream& stream, Replay& replay)
+	{
+		stream.u8();
+		stream.skip(4);
+
+		// Arbiter's beginner board is the older 8x8 one
+		quint32 mines = 0;
+		switch (stream.u8())
+		{
+		case 3:
+			replay.rows = replay.columns = 8;
+			mines                        = 10;
+			break;
+		case 4:
+			replay.rows = replay.columns = 16;
+			mines                        = 40;
+			break;
+		case 5:
+			replay.rows    = 16;
+			replay.columns = 30;
+			mines          = 99;
+			break;
+		case 6:
+			replay.columns = stream.u8() + 1u;
+			replay.rows    = stream.u8() + 1u;
+			mines          = stream.u16();
+			break;
+		default:
+			return QObject::tr("unknown level");
+		}
+		if (!readLayout(stream, replay, mines, true, 1))
+			return QObject::tr("invalid board");
+
+		if (!stream.skipPast("cs="))
+			return QObject::tr("no input");
+		stream.skip(17);
+
+		Mouse mouse(replay);
+		std::array<quint8, 8> record{};
+		while (!mouse.decided())
+		{
+			for (auto& byte : record)
+				byte = stream.u8();
+
+			const quint32 seconds = static_cast<quint32>(record[6]) << 8 | record[2];
+			if (!stream.ok() || !seconds)
+				break;
+
+			const quint64 time = (seconds - 1) * 1'000'000ull + record[4] * 10'000ull;
+			const qint64  x    = static_cast<qint64>(record[1]) << 8 | record[3];
+			const qint64  y    = static_cast<qint64>(record[5]) << 8 | record[7];
+
+			// bit 0 is a move, the others come in pairs of down and up for the left, right and middle buttons
+			const quint8 transitions = record[0];
+			if (transitions & 0x04)
+				mouse.release(Mouse::Left, time, x, y);
+			if (transitions & 0x10)
+				mouse.release(Mouse::Right, time, x, y);
+			if (transitions & 0x40)
+				mouse.release(Mouse::Middle, time, x, y);
+			if (transitions & 0x02)
+				mouse.press(Mouse::Left, time, x, y);
+			if (transitions & 0x08)
+				mouse.press(Mouse::Right, time, x, y);
+			if (transitions & 0x20)
+				mouse.press(Mouse::Middle, time, x, y);
+		}
+		mouse.finish();
+		return {};
+	}
+
+	/// Minesweeper Clone 0.97 and later: the bytes 0x11 0x4D, a header up to offset 27, the level (1 to 3 for the
+	/// presets, 4 for custom), the columns, the rows, a 16-bit mine count and each mine as a 1-based column and row. Then
+	/// a text header with a 16-bit length, a 32-bit record count, and 8-byte records of which buttons are down (bit 0
+	/// left, 1 right, 2 middle), the time in seconds as 16 bits and hundredths, and the position in pixels.
+	QString readClone(Stream& stream, Replay& replay)
+	{
+		if (stream.u8() != 0x11 || stream.u8() != 0x4D)
+			return QObject::tr("unsupported version, only 0.97 and later are");
+		stream.skip(25);
+
+		const quint8 level  = stream.u8();
+		replay.columns      = stream.u8();
+		replay.rows         = stream.u8();
+		const quint32 mines = stream.u16();
+		if (level < 1 || level > 4)
+			return QObject::tr("unknown level");
+		if (!readLayout(stream, replay, mines, false, 1))
+			return QObject::tr("invalid board");
+
+		stream.skip(stream.u16());
+		const quint32 records = stream.u32();
+		if (!stream.ok())
+			return QObject::tr("no input");
+
+		Mouse mouse(replay);
+		for (quint32 record = 0; record < records && !mouse.decided(); ++record)
+		{
+			const quint8  buttons    = stream.u8();
+			const quint32 seconds    = stream.u16();
+			const quint32 hundredths = stream.u8();
+			const qint64  x          = stream.u16();
+			const qint64  y          = stream.u16();
+			if (!stream.ok())
+				break;
+
+			mouse.setButtons(buttons & (Mouse::Left | Mouse::Right | Mouse::Middle), seconds * 1'000'000ull + hundredths * 10'000ull, x, y);
+		}
+		mouse.finish();
+		return {};
+	}
+
+	/// Viennasweeper: the magic `*rmv`, a 16-bit format version of 1, then the sizes of the sections that follow, in
+	/// order: the result string, the version string, the player info, the board, the preflags and the properties as
+	/// 16-bit numbers, the events as a 32-bit number and the checksum as a 16-bit one. The board is the columns, the
+	/// rows, a 16-bit mine count and each mine as a 0-based column and row. Each event starts with a code: 0 and 9 to
+	/// 14 are notices of what the board did, which are skipped, 1 to 7 are a move and the downs and ups of the left,
+	/// right and middle buttons, with the time in milliseconds as 24 bits and the position in pixels. Any other code
+	/// ends the events.
+	QString readViennasweeper(Stream& stream, Replay& replay)
+	{
+		if (stream.u32() != 0x2A726D76 || stream.u16() != 1)
+			return QObject::tr("unsupported version");
+
+		const quint16 resultSize     = stream.u16();
+		const quint16 versionSize    = stream.u16();
+		const quint16 infoSize       = stream.u16();
+		const quint16 boardSize      = stream.u16();
+		const quint16 preflagsSize   = stream.u16();
+		const quint16 propertiesSize = stream.u16();
+		const quint32 eventsSize     = stream.u32();
+		stream.u16();
+		stream.skip(qint64{resultSize} + versionSize + infoSize);
+
+		const qint64 board = stream.position();
+		replay.columns     = stream.u8();
+		replay.rows        = stream.u8();
+		if (!readLayout(stream, replay, stream.u16(), false, 0))
+			return QObject::tr("invalid board");
+		stream.skip(board + boardSize - stream.position());
+		stream.skip(qint64{preflagsSize} + propertiesSize);
+
+		Mouse        mouse(replay);
+		const qint64 end = stream.position() + eventsSize;
+		while (!mouse.decided() && stream.ok() && stream.position() < end)
+		{
+			const quint8 code = stream.u8();
+			if (code == 0)
+			{
+				stream.skip(4);
+				continue;
+			}
+			if (code >= 9 && code <= 14)
+			{
+				stream.skip(2);
+				continue;
+			}
+			if (code > 7)
+				break;
+
+			const quint64 time = stream.u24() * 1'000ull;
+			const qint64  x    = stream.u16();
+			const qint64  y    = stream.u16();
+			if (!stream.ok())
+				break;
+
+			switch (code)
+			{
+			case 2:
+				mouse.press(Mouse::Left, time, x, y);
+				break;
+			case 3:
+				mouse.release(Mouse::Left, time, x, y);
+				break;
+			case 4:
+				mouse.press(Mouse::Right, time, x, y);
+				break;
+			case 5:
+				mouse.release(Mouse::Right, time, x, y);
+				break;
+			case 6:
+				mouse.press(Mouse::Middle, time, x, y);
+				break;
+			case 7:
+				mouse.release(Mouse::Middle, time, x, y);
+				break;
+			default:
+				break;
+			}
+		}
+		mouse.finish();
+		return {};
+	}
+
+	struct Imported
+	{
+		QByteArray replay; ///< encoded, empty if the file could not be converted
+		QString    fileName;
+		QString    error;
+	};
+
+	struct Summary
+	{
+		qsizetype imported = 0;
+		qsizetype failed   = 0;
+	};
+} // namespace
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+const QStringList ReplayImport::NAME_FILTERS = {"*.avf", "*.mvf", "*.rmv"};
+
+ReplayImport::Format ReplayImport::format(const QString& fileName)
+{
+	const QString suffix = QFileInfo(fileName).suffix().toLower();
+	if (suffix == "avf")
+		return Format::Arbiter;
+	if (suffix == "mvf")
+		return Format::Clone;
+	if (suffix == "rmv")
+		return Format::Viennasweeper;
+	return Format::Unknown;
+}
+
+std::optional<Replay> ReplayImport::read(const QString& fileName, QString* error)
+{
+	TRACE_SCOPE("ReplayImport::read");
+
+	auto fail = [error](const QString& reason)
+	{
+		if (error)
+			*error = reason;
+		return std::nullopt;
+	};
+
+	QFile file(fileName);
+	if (!file.open(QIODevice::ReadOnly))
+		return fail(file.errorString());
+
+	// none of the formats keeps the date in a form worth parsing, the file's is close enough
+	Replay replay;
+	replay.started = file.fileTime(QFileDevice::FileModificationTime);
+
+	Stream  stream(file);
+	QString reason;
+	switch (format(fileName))
+	{
+	case Format::Arbiter:
+		reason = readArbiter(stream, replay);
+		break;
+	case Format::Clone:
+		reason = readClone(stream, replay);
+		break;
+	case Format::Viennasweeper:
+		reason = readViennasweeper(stream, replay);
+		break;
+	default:
+		reason = QObject::tr("unknown format");
+		break;
+	}
+
+	if (!reason.isEmpty())
+		return fail(reason);
+	if (replay.events.empty())
+		return fail(QObject::tr("no input"));
+	return replay;
+}
+
+int ReplayImport::run(const QString& source, const QString& directory)
+{
+	QTextStream out(stdout);
+
+	QStringList files;
+	if (QFileInfo(source).isFile())
+		files += source;
+	for (QDirIterator it(source, NAME_FILTERS, QDir::Files, QDirIterator::Subdirectories); it.hasNext();)
+		files += it.next();
+	if (files.isEmpty())
+	{
+		out << "No replays to import in " << source << Qt::endl;
+		return 1;
+	}
+
+	ReplayArchive archive(directory);
+	if (!archive.isOpen())
+	{
+		out << "Unable to open the replay archive in " << directory << Qt::endl;
+		return 1;
+	}
+
+	auto convert = [](const QString& fileName)
+	{
+		Imported imported;
+		imported.fileName = fileName;
+		if (const auto replay = read(fileName, &imported.error))
+			imported.replay = replay->encode();
+		return imported;
+	};
+
+	// reading and converting is spread over every core, so a large corpus is bound by the disk. The archive is only
+	// written from the reduction, which runs one at a time and holds one converted replay, so memory stays flat no
+	// matter how many files there are.
+	auto append = [&archive, &out](Summary& summary, const Imported& imported)
+	{
+		if (!imported.replay.isEmpty() && archive.append(imported.replay))
+		{
+			++summary.imported;
+			return;
+		}
+
+		out << imported.fileName << ": " << (imported.error.isEmpty() ? QObject::tr("unable to write to the archive") : imported.error) << Qt::endl;
+		++summary.failed;
+	};
+
+	QElapsedTimer timer;
+	timer.start();
+	const Summary summary   = QtConcurrent::mappedReduced<Summary>(files, convert, append).result();
+	const qint64  elapsedMs = timer.elapsed();
+
+	out << "Imported " << summary.imported << " of " << files.size() << " replays in " << elapsedMs << " ms, " << summary.failed << " failed"
+		<< Qt::endl;
+	return summary.failed ? 1 : 0;
+}
\ No newline at end of file
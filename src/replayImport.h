@@ -0,0 +1,83 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       replayImport.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `ReplayImport` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef REPLAYIMPORT_H
+#define REPLAYIMPORT_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "replay.h"
+
+#include <QString>
+#include <QStringList>
+
+#include <optional>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: ReplayImport
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Converts games recorded by other minesweeper programs into our own replays.
+/// @details Understands the videos of Minesweeper Arbiter (`.avf`), Minesweeper Clone / Minesweeper X (`.mvf`, from
+///          version 0.97 on) and Viennasweeper (`.rmv`). Each is read front to back through a fixed buffer, without
+///          loading the file or allocating per record. The files hold the mine layout and the raw mouse input on a
+///          grid of 16 pixel squares. The mouse input is played against a board core with that layout, which
+///          resolves it into the reveals, flags and chords a replay records, and the result is whatever the core
+///          arrives at. A converted replay therefore always verifies, see `ReplayEngine`.
+//----------------------------------------------------------------------------------------------------------------------
+class ReplayImport
+{
+public:
+
+	enum class Format
+	{
+		Unknown,
+		Arbiter,       ///< .avf
+		Clone,         ///< .mvf
+		Viennasweeper, ///< .rmv
+	};
+
+	static constexpr quint32 SQUARE_SIZE = 16; ///< pixels per cell in every supported format
+
+	/// name filters for the files `importAll()` picks up
+	static const QStringList NAME_FILTERS;
+
+public:
+
+	[[nodiscard]] static Format                format(const QString& fileName);
+	[[nodiscard]] static std::optional<Replay> read(const QString& fileName, QString* error = nullptr);
+
+	/// converts every supported file under `source` on the global thread pool and appends them to the archive in
+	/// `directory`, for `minesweeper --import-replays source [directory]`
+	static int run(const QString& source, const QString& directory);
+};
+
+#endif // REPLAYIMPORT_H
\ No newline at end of file
@@ -0,0 +1,215 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       replayRecorder.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `replayRecorder.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "replayRecorder.h"
+#include "trace.h"
+
+#include <QDir>
+#include <QStandardPaths>
+
+//----------------------------
+//  LOCAL DEFINITIONS
+//----------------------------
+
+namespace
+{
+	constexpr const char* RECORDING_FILE_NAME = "recording.msreplay";
+} // namespace
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+ReplayRecorder::~ReplayRecorder()
+{
+	// a game that is still being recorded at this point wasn't put aside, so closing gives up on it. The archive may
+	// already be gone by now, so the recording is archived on the next start instead.
+	close(Replay::Result::Forfeit);
+}
+
+QString ReplayRecorder::defaultDirectory()
+{
+	return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/replays";
+}
+
+void ReplayRecorder::setArchive(ReplayArchive* archive)
+{
+	m_archive = archive && archive->isOpen() ? archive : nullptr;
+	recover();
+}
+
+void ReplayRecorder::start(const BoardCore& core, BoardCore::Index firstCell)
+{
+	TRACE_SCOPE("ReplayRecorder::start");
+
+	finish(Replay::Result::Forfeit);
+	archiveInterrupted();
+	if (!m_archive)
+		return;
+
+	Replay header;
+	header.rows      = core.rows();
+	header.columns   = core.columns();
+	header.mines     = core.mines();
+	header.seed      = core.seed();
+	header.firstCell = firstCell;
+	header.started   = QDateTime::currentDateTime();
+
+	if (!m_file.open(recordingPath(), QIODevice::WriteOnly | QIODevice::Truncate))
+		return;
+
+	m_buffer.clear();
+	m_recording.clear();
+	Replay::appendHeader(m_buffer, header);
+	m_previous    = header.origin();
+	m_clockOffset = 0;
+	m_clock.start();
+	flush();
+}
+
+bool ReplayRecorder::resume(const BoardCore& core)
+{
+	TRACE_SCOPE("ReplayRecorder::resume");
+
+	if (!m_interrupted || !m_archive || isRecording())
+		return false;
+
+	const Replay& replay = *m_interrupted;
+	if (replay.rows != core.rows() || replay.columns != core.columns() || replay.mines != core.mines() || replay.seed != core.seed() ||
+		replay.firstCell != core.firstCell())
+	{
+		archiveInterrupted();
+		return false;
+	}
+
+	// a record cut off by the crash is dropped, and the recording goes on from the last complete one, its time
+	// picking up where it stopped
+	QByteArray recording = replay.encode();
+	if (!QFile::resize(recordingPath(), recording.size()) || !m_file.open(recordingPath(), QIODevice::WriteOnly | QIODevice::Append))
+	{
+		archiveInterrupted();
+		return false;
+	}
+
+	m_buffer.clear();
+	m_recording   = std::move(recording);
+	m_previous    = replay.events.empty() ? replay.origin() : replay.events.back();
+	m_clockOffset = m_previous.time;
+	m_clock.start();
+	m_interrupted.reset();
+	return true;
+}
+
+void ReplayRecorder::record(Replay::Action action, BoardCore::Index cell)
+{
+	if (!isRecording() || cell == BoardCore::NoCell)
+		return;
+
+	const Replay::Event event{elapsed(), cell, action};
+	Replay::appendEvent(m_buffer, event, m_previous);
+	m_previous = event;
+}
+
+void ReplayRecorder::finish(Replay::Result result)
+{
+	if (!isRecording())
+		return;
+
+	close(result);
+	if (m_archive->append(m_recording))
+		QFile::remove(recordingPath());
+}
+
+void ReplayRecorder::suspend()
+{
+	if (!isRecording())
+		return;
+
+	flush();
+	m_file.close();
+}
+
+void ReplayRecorder::close(Replay::Result result)
+{
+	if (!isRecording())
+		return;
+
+	Replay::appendEnd(m_buffer, result, elapsed(), m_previous);
+	flush();
+	m_file.close();
+}
+
+void ReplayRecorder::recover()
+{
+	if (!m_archive || isRecording())
+		return;
+
+	// the game that was unfinished when the last session ended is kept to be resumed, if it can be. Anything else
+	// left behind, replays recorded before there was an archive among them, is archived.
+	const QDir dir(m_archive->directory());
+	for (const auto& name : dir.entryList({"*.msreplay"}, QDir::Files, QDir::Name))
+	{
+		QFile            file(dir.filePath(name));
+		const QByteArray data = file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+		if (name == RECORDING_FILE_NAME && !m_interrupted)
+		{
+			// only a recording that reads back the same as it was written can be appended to
+			auto replay = Replay::decode(data);
+			if (replay && replay->result == Replay::Result::Unfinished && replay->layout.empty() && data.startsWith(replay->encode()))
+			{
+				m_interrupted = std::move(replay);
+				continue;
+			}
+		}
+		if (!data.isEmpty() && m_archive->append(data))
+			file.remove();
+	}
+}
+
+void ReplayRecorder::archiveInterrupted()
+{
+	if (!m_interrupted)
+		return;
+
+	m_interrupted.reset();
+	QFile file(recordingPath());
+	if (m_archive && file.open(QIODevice::ReadOnly) && m_archive->append(file.readAll()))
+		file.remove();
+}
+
+QString ReplayRecorder::recordingPath() const
+{
+	return QDir(m_archive->directory()).filePath(RECORDING_FILE_NAME);
+}
+
+quint64 ReplayRecorder::elapsed() const
+{
+	return m_clockOffset + static_cast<quint64>(m_clock.nsecsElapsed() / 1000);
+}
+
+void ReplayRecorder::flush()
+{
+	if (!isRecording() || m_buffer.isEmpty())
+		return;
+
+	// only queued here, the journal writes and syncs it in the background
+	m_file.append(m_buffer);
+	m_recording += m_buffer;
+	m_buffer.clear();
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       replayRecorder.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `ReplayRecorder` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef REPLAYRECORDER_H
+#define REPLAYRECORDER_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "journalFile.h"
+#include "replay.h"
+#include "replayArchive.h"
+
+#include <QElapsedTimer>
+#include <QString>
+
+#include <optional>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: ReplayRecorder
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Writes the replay of the game in progress to disk as it is played, and archives it once it is over.
+/// @details The game in progress goes to a file of its own next to the archive, a journal that is only ever appended
+///          to. Events are encoded into a small buffer that the board flushes once per click, after the buttons are
+///          released, and written and synced to disk in the background, see `JournalFile`. Even a crash of the whole
+///          machine loses no more than the last few clicks. A finished game is appended to the archive and its file
+///          removed.
+///
+///          The file of a game that is unfinished when the session ends, put aside or cut short by a crash, is kept.
+///          The next session can bring the game back and go on recording it with `resume()`, and the moves in it are
+///          what brings back a game that crashed. Any other file left behind is archived the next time the recorder
+///          is given the archive. Recording is off until then.
+//----------------------------------------------------------------------------------------------------------------------
+class ReplayRecorder
+{
+public:
+
+	ReplayRecorder() = default;
+	~ReplayRecorder();
+
+	ReplayRecorder(const ReplayRecorder&)            = delete;
+	ReplayRecorder& operator=(const ReplayRecorder&) = delete;
+
+	/// where the game keeps its replays
+	[[nodiscard]] static QString defaultDirectory();
+
+	void               setArchive(ReplayArchive* archive);
+	[[nodiscard]] bool isRecording() const noexcept { return m_file.isOpen(); }
+
+	/// starts a new recording once the first click has placed the mines
+	void start(const BoardCore& core, BoardCore::Index firstCell);
+	void record(Replay::Action action, BoardCore::Index cell);
+	void flush(); ///< writes the events recorded so far, call once per click
+	void finish(Replay::Result result);
+	void suspend(); ///< stops recording, and leaves the game to be resumed by the next session
+
+	/// the unfinished game of the last session, if it can still be resumed
+	[[nodiscard]] const std::optional<Replay>& interrupted() const noexcept { return m_interrupted; }
+
+	/// goes on recording the unfinished game of the last session, once `core` is back where the game stopped
+	bool resume(const BoardCore& core);
+
+private:
+
+	void                  close(Replay::Result result);
+	void                  recover();
+	void                  archiveInterrupted();
+	[[nodiscard]] QString recordingPath() const;
+	[[nodiscard]] quint64 elapsed() const; ///< microseconds since the first click, as far as the recording goes
+
+private:
+
+	ReplayArchive*        m_archive = nullptr;
+	JournalFile           m_file;
+	QElapsedTimer         m_clock;
+	quint64               m_clockOffset = 0; ///< time recorded in an earlier session
+	QByteArray            m_buffer;
+	QByteArray            m_recording; ///< everything written to `m_file`, for the archive
+	Replay::Event         m_previous;
+	std::optional<Replay> m_interrupted;
+};
+
+#endif // REPLAYRECORDER_H
\ No newline at end of file
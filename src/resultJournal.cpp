@@ -0,0 +1,267 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       resultJournal.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `resultJournal.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "resultJournal.h"
+#include "trace.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+
+//----------------------------
+//  LOCAL DEFINITIONS
+//----------------------------
+
+namespace
+{
+	constexpr char   SNAPSHOT_MAGIC[4] = {'M', 'S', 'R', 'S'};
+	constexpr quint8 SNAPSHOT_VERSION  = 1;
+
+	quint16 checksum(const ResultJournal::Record& record)
+	{
+		return qChecksum(QByteArrayView(reinterpret_cast<const char*>(&record), offsetof(ResultJournal::Record, checksum)));
+	}
+
+	/// each leaderboard and the statistics are a blob of their own, in the format of the settings. Their readers look
+	/// for the end of the stream to know which of their later additions they have.
+	QByteArray encodeSnapshot(quint64 sequence, const ResultJournal::HighScores& highScores, const GameStats& stats)
+	{
+		QByteArray  out;
+		QDataStream stream(&out, QIODevice::WriteOnly);
+		stream.writeRawData(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+		stream << SNAPSHOT_VERSION << sequence << static_cast<quint32>(highScores.size());
+		for (const auto& model : highScores)
+		{
+			QByteArray  data;
+			QDataStream modelStream(&data, QIODevice::WriteOnly);
+			modelStream << model;
+			stream << data;
+		}
+
+		QByteArray  data;
+		QDataStream statsStream(&data, QIODevice::WriteOnly);
+		statsStream << stats;
+		stream << data;
+		return out;
+	}
+
+	/// the sequence number of the last result in the snapshot, which replaces the results it is read into
+	std::optional<quint64> decodeSnapshot(const QByteArray& snapshot, ResultJournal::HighScores& highScores, GameStats& stats)
+	{
+		QDataStream stream(snapshot);
+		char        magic[sizeof(SNAPSHOT_MAGIC)];
+		quint8      version  = 0;
+		quint64     sequence = 0;
+		quint32     count    = 0;
+		if (stream.readRawData(magic, sizeof(magic)) != sizeof(magic) ||
+			QByteArrayView(magic, sizeof(magic)) != QByteArrayView(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)))
+			return std::nullopt;
+
+		stream >> version >> sequence >> count;
+		if (stream.status() != QDataStream::Ok || version < 1 || version > SNAPSHOT_VERSION)
+			return std::nullopt;
+
+		for (quint32 i = 0; i < count; ++i)
+		{
+			QByteArray data;
+			stream >> data;
+			if (stream.status() != QDataStream::Ok)
+				return std::nullopt;
+
+			HighScoreModel model;
+			QDataStream    modelStream(&data, QIODevice::ReadOnly);
+			modelStream >> model;
+			if (model.boardSize().isValid())
+				highScores[model.boardSize()] = std::move(model);
+		}
+
+		QByteArray data;
+		stream >> data;
+		if (stream.status() != QDataStream::Ok)
+			return std::nullopt;
+
+		QDataStream statsStream(&data, QIODevice::ReadOnly);
+		statsStream >> stats;
+		return sequence;
+	}
+} // namespace
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+ResultJournal::ResultJournal(const QString& directory)
+	: m_directory(directory)
+{
+	TRACE_SCOPE("ResultJournal::ResultJournal");
+
+	if (!QDir().mkpath(directory))
+		return;
+
+	// a crash in the middle of appending a record leaves part of it behind
+	const QString fileName = QDir(directory).filePath(JOURNAL_FILE_NAME);
+	if (QFile journal(fileName); journal.open(QIODevice::ReadWrite))
+	{
+		if (const qint64 partial = journal.size() % static_cast<qint64>(sizeof(Record)))
+			journal.resize(journal.size() - partial);
+	}
+
+	m_journal.open(fileName, QIODevice::WriteOnly | QIODevice::Append);
+}
+
+QString ResultJournal::defaultDirectory()
+{
+	return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+}
+
+bool ResultJournal::hasSnapshot() const
+{
+	return QFile::exists(QDir(m_directory).filePath(SNAPSHOT_FILE_NAME));
+}
+
+bool ResultJournal::load(HighScores& highScores, GameStats& stats)
+{
+	TRACE_SCOPE("ResultJournal::load");
+
+	std::optional<quint64> snapshot;
+	if (QFile file(QDir(m_directory).filePath(SNAPSHOT_FILE_NAME)); file.open(QIODevice::ReadOnly))
+		snapshot = decodeSnapshot(file.readAll(), highScores, stats);
+	m_sequence  = snapshot.value_or(0);
+	m_journaled = 0;
+
+	QFile journal(QDir(m_directory).filePath(JOURNAL_FILE_NAME));
+	if (!journal.open(QIODevice::ReadOnly))
+		return snapshot.has_value();
+
+	Record record;
+	while (journal.read(reinterpret_cast<char*>(&record), sizeof(record)) == sizeof(record))
+	{
+		// the journal is only emptied after the snapshot that replaces it is written, so it may still hold records
+		// the snapshot includes
+		if (record.checksum != checksum(record) || (snapshot && record.sequence <= *snapshot))
+			continue;
+
+		const BoardSize size = record.boardSize();
+		if (!size.isValid())
+			continue;
+
+		switch (static_cast<Kind>(record.kind))
+		{
+		case Kind::Game:
+		{
+			BoardCore::Metrics metrics;
+			metrics.threeBV         = record.threeBV;
+			metrics.solvedThreeBV   = record.solvedThreeBV;
+			metrics.clicks          = record.clicks;
+			metrics.effectiveClicks = record.effectiveClicks;
+			stats.addStat(size, static_cast<GameStats::GameType>(record.type), record.milliseconds, metrics);
+			break;
+		}
+		case Kind::HighScore:
+		{
+			if (!highScores.contains(size))
+				highScores.insert(size, HighScoreModel(size));
+
+			const QString name = QString::fromUtf8(record.name, static_cast<qsizetype>(qstrnlen(record.name, NAME_BYTES)));
+			highScores[size].addHighScore(HighScore(name, static_cast<HighScore::Difficulty>(record.type), static_cast<quint32>(record.milliseconds),
+													QDateTime::fromMSecsSinceEpoch(record.date), record.threeBV, record.clicks));
+			break;
+		}
+		default:
+			continue;
+		}
+
+		m_sequence = std::max(m_sequence, record.sequence);
+		++m_journaled;
+	}
+	return snapshot.has_value();
+}
+
+void ResultJournal::addGame(const BoardSize& size, GameStats::GameType type, quint64 milliseconds, const BoardCore::Metrics& metrics)
+{
+	Record record{};
+	record.kind            = static_cast<quint8>(Kind::Game);
+	record.type            = static_cast<quint8>(type);
+	record.date            = QDateTime::currentMSecsSinceEpoch();
+	record.milliseconds    = milliseconds;
+	record.rows            = size.rows;
+	record.columns         = size.columns;
+	record.mines           = size.mines;
+	record.threeBV         = metrics.threeBV;
+	record.solvedThreeBV   = metrics.solvedThreeBV;
+	record.clicks          = metrics.clicks;
+	record.effectiveClicks = metrics.effectiveClicks;
+	append(record);
+}
+
+void ResultJournal::addHighScore(const BoardSize& size, const HighScore& score)
+{
+	Record record{};
+	record.kind         = static_cast<quint8>(Kind::HighScore);
+	record.type         = static_cast<quint8>(score.difficulty());
+	record.date         = score.date().toMSecsSinceEpoch();
+	record.milliseconds = score.time();
+	record.rows         = size.rows;
+	record.columns      = size.columns;
+	record.mines        = size.mines;
+	record.threeBV      = score.threeBV();
+	record.clicks       = score.clicks();
+
+	// a name too long for the record loses its end, but never half of a character
+	QByteArray name = score.name().toUtf8();
+	if (name.size() > NAME_BYTES)
+	{
+		qsizetype end = NAME_BYTES;
+		while (end > 0 && (static_cast<quint8>(name[end]) & 0xC0) == 0x80)
+			--end;
+		name.truncate(end);
+	}
+	std::memcpy(record.name, name.constData(), static_cast<size_t>(name.size()));
+	append(record);
+}
+
+void ResultJournal::compact(const HighScores& highScores, const GameStats& stats)
+{
+	TRACE_SCOPE("ResultJournal::compact");
+
+	// the snapshot is taken now, and written once every record before it is on disk. The journal is only emptied
+	// after the snapshot is, so there is no moment a crash could lose either.
+	m_journaled = 0;
+	m_journal.truncate(
+		[snapshot = encodeSnapshot(m_sequence, highScores, stats), fileName = QDir(m_directory).filePath(SNAPSHOT_FILE_NAME)]
+		{
+			QSaveFile file(fileName);
+			return file.open(QIODevice::WriteOnly) && file.write(snapshot) == snapshot.size() && file.commit();
+		});
+}
+
+void ResultJournal::append(Record& record)
+{
+	record.sequence = ++m_sequence;
+	record.checksum = checksum(record);
+	m_journal.append(QByteArray(reinterpret_cast<const char*>(&record), sizeof(record)));
+	++m_journaled;
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       resultJournal.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `ResultJournal` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+#ifndef RESULTJOURNAL_H
+#define RESULTJOURNAL_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "boardSize.h"
+#include "gameStats.h"
+#include "highScoreModel.h"
+#include "journalFile.h"
+
+#include <QMap>
+#include <QString>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: ResultJournal
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Keeps the leaderboards and the statistics on disk, one game at a time.
+/// @details Two files in one directory:
+///
+///          - `results.snapshot`: the leaderboards and the statistics as of some point, in the format the settings
+///            used to hold them, and the sequence number of the last result they include.
+///          - `results.journal`: one fixed-size `Record` per result since, a finished game or a high score, appended
+///            the moment it happens.
+///
+///          Recording a result is a single small append, synced to disk in the background by a `JournalFile`, however
+///          long the history is. Every `COMPACTION_RECORDS` results the snapshot is written again, on the journal's
+///          writer, and the journal is emptied only once the new snapshot is on disk. A record torn by a crash fails
+///          its checksum and is dropped, and records the snapshot already includes are skipped, so whatever point a
+///          crash comes at, every result that reached the disk is kept, exactly once. The records use the byte order
+///          of the machine, like the replay archive.
+//----------------------------------------------------------------------------------------------------------------------
+class ResultJournal
+{
+public:
+
+	using HighScores = QMap<BoardSize, HighScoreModel>;
+
+	static constexpr const char* JOURNAL_FILE_NAME  = "results.journal";
+	static constexpr const char* SNAPSHOT_FILE_NAME = "results.snapshot";
+	static constexpr int         COMPACTION_RECORDS = 64;
+	static constexpr int         NAME_BYTES         = 64;
+
+	enum class Kind : quint8
+	{
+		Game,
+		HighScore,
+	};
+
+	struct Record
+	{
+		quint64 sequence;
+		qint64  date;         ///< ms since the epoch
+		quint64 milliseconds; ///< of play
+		quint32 rows;
+		quint32 columns;
+		quint32 mines;
+		quint32 threeBV;
+		quint32 solvedThreeBV;
+		quint32 clicks;
+		quint32 effectiveClicks;
+		quint8  kind;
+		quint8  type;             ///< the `GameStats::GameType` of a game, the `HighScore::Difficulty` of a high score
+		char    name[NAME_BYTES]; ///< of a high score, UTF-8 padded with zeros
+		quint8  reserved[8];
+		quint16 checksum; ///< of everything before it
+
+		[[nodiscard]] BoardSize boardSize() const { return {rows, columns, mines}; }
+	};
+	static_assert(sizeof(Record) == 128, "the journal is read record by record, their layout must not change");
+
+public:
+
+	explicit ResultJournal(const QString& directory);
+
+	ResultJournal(const ResultJournal&)            = delete;
+	ResultJournal& operator=(const ResultJournal&) = delete;
+
+	static QString defaultDirectory();
+
+	/// there are results on disk from an earlier `compact()`
+	[[nodiscard]] bool hasSnapshot() const;
+
+	/// replaces `highScores` and `stats` with the snapshot, and adds every result journaled after it. Without a
+	/// snapshot the journal is added to what they already hold, the results from before there was a journal, and
+	/// false is returned to have them handed to `compact()`.
+	bool load(HighScores& highScores, GameStats& stats);
+
+	void addGame(const BoardSize& size, GameStats::GameType type, quint64 milliseconds, const BoardCore::Metrics& metrics);
+	void addHighScore(const BoardSize& size, const HighScore& score);
+
+	/// time for `compact()`
+	[[nodiscard]] bool needsCompaction() const noexcept { return m_journaled >= COMPACTION_RECORDS; }
+
+	/// replaces the snapshot with `highScores` and `stats`, which must include every result added so far, and
+	/// empties the journal. Both are written in the background.
+	void compact(const HighScores& highScores, const GameStats& stats);
+
+private:
+
+	void append(Record& record);
+
+private:
+
+	QString     m_directory;
+	JournalFile m_journal;
+	quint64     m_sequence  = 0; ///< of the last result
+	int         m_journaled = 0; ///< results since the last snapshot
+};
+
+#endif // RESULTJOURNAL_H
\ No newline at end of file
@@ -0,0 +1,158 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       savedGame.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `savedGame.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "savedGame.h"
+#include "boardSize.h"
+#include "trace.h"
+
+#include <QDataStream>
+#include <QStandardPaths>
+
+#include <vector>
+
+//----------------------------
+//  LOCAL DEFINITIONS
+//----------------------------
+
+namespace
+{
+	qsizetype bitmapSize(quint32 rows, quint32 columns) { return static_cast<qsizetype>((static_cast<quint64>(rows) * columns + 7) / 8); }
+
+	std::span<quint8> bits(QByteArray& bitmap) { return {reinterpret_cast<quint8*>(bitmap.data()), static_cast<size_t>(bitmap.size())}; }
+
+	std::span<const quint8> bits(const QByteArray& bitmap)
+	{
+		return {reinterpret_cast<const quint8*>(bitmap.constData()), static_cast<size_t>(bitmap.size())};
+	}
+} // namespace
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+QString SavedGame::defaultPath()
+{
+	return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/suspended.msgame";
+}
+
+SavedGame SavedGame::capture(const BoardCore& core)
+{
+	TRACE_SCOPE("SavedGame::capture");
+
+	SavedGame game;
+	game.rows      = core.rows();
+	game.columns   = core.columns();
+	game.mines     = core.mines();
+	game.seed      = core.seed();
+	game.firstCell = core.firstCell();
+	game.metrics   = core.metrics();
+	game.practice  = core.historyEnabled();
+
+	const qsizetype size = bitmapSize(game.rows, game.columns);
+	if (game.firstCell == BoardCore::NoCell)
+	{
+		game.mineBitmap.resize(size);
+		core.packBits(BoardCore::MineBit, bits(game.mineBitmap));
+	}
+	game.revealed.resize(size);
+	core.packBits(BoardCore::RevealedBit, bits(game.revealed));
+	game.flagged.resize(size);
+	core.packBits(BoardCore::FlaggedBit, bits(game.flagged));
+	game.threeBV.resize(size);
+	core.packBits(BoardCore::ThreeBVBit, bits(game.threeBV));
+	return game;
+}
+
+bool SavedGame::restore(BoardCore& core) const
+{
+	TRACE_SCOPE("SavedGame::restore");
+
+	if (core.rows() != rows || core.columns() != columns || core.state() != BoardCore::State::Unstarted)
+		return false;
+
+	core.reset(mines);
+	if (firstCell == BoardCore::NoCell)
+	{
+		std::vector<BoardCore::Index> layout;
+		layout.reserve(mines);
+		for (BoardCore::Index cell = 0; cell < core.cellCount(); ++cell)
+		{
+			if (mineBitmap[cell >> 3] & (1 << (cell & 7)))
+				layout.push_back(cell);
+		}
+		core.placeMines(layout);
+	}
+	else
+	{
+		core.placeMines(firstCell, seed);
+	}
+
+	core.setHistoryEnabled(practice);
+	return core.resume(bits(revealed), bits(flagged), bits(threeBV), metrics);
+}
+
+QByteArray SavedGame::encode() const
+{
+	TRACE_SCOPE("SavedGame::encode");
+
+	QByteArray  out;
+	QDataStream stream(&out, QIODevice::WriteOnly);
+	stream.writeRawData(MAGIC, sizeof(MAGIC));
+	stream << VERSION << rows << columns << mines << seed << firstCell << elapsed << metrics.threeBV << metrics.solvedThreeBV << metrics.clicks
+		   << metrics.effectiveClicks << practice;
+	if (firstCell == BoardCore::NoCell)
+		stream.writeRawData(mineBitmap.constData(), mineBitmap.size());
+	stream.writeRawData(revealed.constData(), revealed.size());
+	stream.writeRawData(flagged.constData(), flagged.size());
+	stream.writeRawData(threeBV.constData(), threeBV.size());
+	return out;
+}
+
+std::optional<SavedGame> SavedGame::decode(const QByteArray& data)
+{
+	TRACE_SCOPE("SavedGame::decode");
+
+	QDataStream stream(data);
+	char        magic[sizeof(MAGIC)];
+	quint8      version = 0;
+	if (stream.readRawData(magic, sizeof(magic)) != sizeof(magic) || QByteArrayView(magic, sizeof(magic)) != QByteArrayView(MAGIC, sizeof(MAGIC)))
+		return std::nullopt;
+
+	SavedGame game;
+	stream >> version >> game.rows >> game.columns >> game.mines >> game.seed >> game.firstCell >> game.elapsed >> game.metrics.threeBV >>
+		game.metrics.solvedThreeBV >> game.metrics.clicks >> game.metrics.effectiveClicks >> game.practice;
+	const BoardSize boardSize{game.rows, game.columns, game.mines};
+	if (stream.status() != QDataStream::Ok || version < 1 || version > VERSION || !boardSize.isValid() ||
+		(game.firstCell >= boardSize.cellCount() && game.firstCell != BoardCore::NoCell))
+		return std::nullopt;
+
+	// the size of the bitmaps follows from the board, which is bounded, so a damaged file can't make them huge
+	const qsizetype size    = bitmapSize(game.rows, game.columns);
+	auto            readMap = [&](QByteArray& bitmap)
+	{
+		bitmap.resize(size);
+		return stream.readRawData(bitmap.data(), static_cast<int>(size)) == size;
+	};
+	if (game.firstCell == BoardCore::NoCell && !readMap(game.mineBitmap))
+		return std::nullopt;
+	if (!readMap(game.revealed) || !readMap(game.flagged) || !readMap(game.threeBV))
+		return std::nullopt;
+
+	return game;
+}
\ No newline at end of file
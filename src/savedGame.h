@@ -0,0 +1,94 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       savedGame.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `SavedGame` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef SAVEDGAME_H
+#define SAVEDGAME_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "boardCore.h"
+
+#include <QByteArray>
+#include <QString>
+
+#include <optional>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: SavedGame
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief A game in progress, put aside when the game is closed and continued on the next start.
+/// @details The binary format is the magic `MSSG`, a version byte, then in the byte order of `QDataStream` the rows,
+///          columns, mines, seed, first clicked cell, milliseconds played, the metrics and whether it is a practice
+///          game, followed by bitmaps of one bit per cell, eight to a byte: the mines if there is no first cell to
+///          place them from, then the cells revealed, flagged and still marked as 3BV.
+///
+///          The numbers and the counts are worked out again from those in one pass over the board, without a flood, so
+///          even a board of four million cells takes a megabyte and a half and is written and read back in
+///          milliseconds.
+//----------------------------------------------------------------------------------------------------------------------
+class SavedGame
+{
+public:
+
+	static constexpr char   MAGIC[4] = {'M', 'S', 'S', 'G'};
+	static constexpr quint8 VERSION  = 1;
+
+public:
+
+	quint32            rows      = 0;
+	quint32            columns   = 0;
+	quint32            mines     = 0;
+	quint64            seed      = 0;
+	BoardCore::Index   firstCell = BoardCore::NoCell;
+	quint64            elapsed  = 0; ///< milliseconds played before the game was put aside
+	BoardCore::Metrics metrics;
+	bool               practice = false;
+	QByteArray         mineBitmap; ///< only for a layout that didn't come from the seed
+	QByteArray         revealed;
+	QByteArray         flagged;
+	QByteArray         threeBV; ///< the cells with `ThreeBVBit`
+
+public:
+
+	/// where the game in progress is kept between sessions
+	[[nodiscard]] static QString defaultPath();
+
+	[[nodiscard]] static SavedGame capture(const BoardCore& core);
+
+	/// sets up the game again on a core of the same dimensions
+	bool restore(BoardCore& core) const;
+
+	[[nodiscard]] QByteArray                      encode() const;
+	[[nodiscard]] static std::optional<SavedGame> decode(const QByteArray& data);
+};
+
+#endif // SAVEDGAME_H
\ No newline at end of file
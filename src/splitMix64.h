@@ -0,0 +1,88 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       splitMix64.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `SplitMix64` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef SPLITMIX64_H
+#define SPLITMIX64_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include <QtGlobal>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: SplitMix64
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Small, fast PRNG whose output is identical on every platform, so a seed always produces the same board.
+//----------------------------------------------------------------------------------------------------------------------
+class SplitMix64
+{
+public:
+
+	explicit SplitMix64(quint64 seed)
+		: m_state(seed)
+	{
+	}
+
+	/// the output function on its own, a good 64-bit hash of `value`
+	static constexpr quint64 mix(quint64 value) noexcept
+	{
+		quint64 z = value + 0x9E3779B97F4A7C15ull;
+		z         = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z         = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	quint64 operator()() noexcept
+	{
+		const quint64 value = mix(m_state);
+		m_state += 0x9E3779B97F4A7C15ull;
+		return value;
+	}
+
+	/// unbiased value in [0, bound)
+	quint64 bounded(quint64 bound) noexcept
+	{
+		const quint64 threshold = (0 - bound) % bound;
+		quint64       value;
+		do
+		{
+			value = (*this)();
+		}
+		while (value < threshold);
+		return value % bound;
+	}
+
+private:
+
+	quint64 m_state;
+};
+
+#endif // SPLITMIX64_H
\ No newline at end of file
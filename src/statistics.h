@@ -276,6 +276,26 @@ public:
 		return *this;
 	}
 
+	/**
+	 * @brief		Scales every measurement of the population.
+	 * @details		O(1) complexity. Changes the unit the measurements are in.
+	 * @param[in]	factor	value to multiply each measurement by.
+	 * @returns		Reference to this.
+	 */
+	Statistics& operator*=(const T& factor) noexcept
+	{
+		// an empty population keeps the limits it starts from
+		if (!m_count)
+			return *this;
+
+		m_max *= factor;
+		m_min *= factor;
+		m_sum *= factor;
+		m_sumOfSquares *= factor * factor;
+
+		return *this;
+	}
+
 	//------------------------------
 	//	FRIEND OPERATORS
 	//------------------------------
@@ -1,18 +1,11 @@
 #include "tile.h"
-
-#include <thread>
-#include <chrono>
+#include "imageCache.h"
 
 #include <QDebug>
-#include <QState>
-#include <QFinalState>
-#include <QMouseEvent>
 #include <QSizePolicy>
 #include <QGuiApplication>
 #include <QStyleHints>
 
-bool Tile::m_firstClick = false;
-
 const QString Tile::unrevealedStyleSheetLight =
 	"Tile"
 	"{"
@@ -69,64 +62,42 @@ QIcon Tile::blankIcon()
 
 QIcon Tile::flagIcon()
 {
-	static QIcon icon = QIcon(QPixmap(":/flag").scaled(QSize(20, 20)));
-	return icon;
+	return ImageCache::icon(ImageCache::Flag);
 }
 
 QIcon Tile::mineIcon()
 {
-	static QIcon icon = QIcon(QPixmap(":/mine").scaled(QSize(20, 20)));
-	return icon;
+	return ImageCache::icon(ImageCache::Mine);
 }
 
 QIcon Tile::explosionIcon()
 {
-	static QIcon icon = QIcon(QPixmap(":/explosion").scaled(QSize(20, 20)));
-	return icon;
+	return ImageCache::icon(ImageCache::Explosion);
 }
 
 QIcon Tile::tadaIcon()
 {
-	static QIcon icon = QIcon(QPixmap(":/tada").scaled(QSize(22, 22)));
-	return icon;
+	return ImageCache::icon(ImageCache::Tada);
 }
 
 QIcon Tile::wrongIcon()
 {
-	static QIcon icon = QIcon(QPixmap(":/wrong").scaled(QSize(22, 22)));
-	return icon;
+	return ImageCache::icon(ImageCache::Wrong);
 }
 
 Tile::Tile(TileLocation location, QWidget* parent /*= nullptr*/)
-	: m_isMine(false)
+	: m_state(Unrevealed)
 	, m_adjacentMineCount(0)
-	, m_adjacentFlaggedCount(0)
 	, m_location(location)
 	, QPushButton(parent)
 {
-	createStateMachine();
 	this->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
 	setCheckable(true);
-	setMouseTracking(true);
 
-	this->setTheme(QGuiApplication::styleHints()->colorScheme());
-}
-
-Tile::~Tile()
-{
-	m_firstClick = false;
-	delete unrevealedState;
-	delete previewState;
-	delete flaggedState;
-	delete revealedState;
-	delete disabledState;
-}
+	// all mouse input is routed through the GameBoard
+	setAttribute(Qt::WA_TransparentForMouseEvents);
 
-void Tile::addNeighbor(Tile* tile)
-{
-	m_neighbors += tile;
-	connect(this, &Tile::revealNeighbors, tile, &Tile::reveal, Qt::QueuedConnection);
-	connect(this, &Tile::unPreviewNeighbors, tile, &Tile::unPreview, Qt::QueuedConnection);
+	this->setTheme(QGuiApplication::styleHints()->colorScheme());
 }
 
 TileLocation Tile::location() const
@@ -134,218 +105,69 @@ TileLocation Tile::location() const
 	return m_location;
 }
 
-void Tile::placeMine(bool val)
-{
-	m_isMine = val;
-	for (auto neighbor : m_neighbors)
-		neighbor->incrementAdjacentMineCount();
-}
-
-bool Tile::isMine() const
-{
-	return m_isMine;
-}
-
-bool Tile::hasAdjacentMines() const
-{
-	return m_adjacentMineCount;
-}
-
-unsigned int Tile::adjacentMineCount() const
-{
-	return m_adjacentMineCount;
-}
-
-void Tile::incrementAdjacentMineCount()
+void Tile::setLocation(TileLocation location)
 {
-	++m_adjacentMineCount;
+	m_location = location;
 }
 
-bool Tile::isFlagged() const
+Tile::State Tile::state() const
 {
-	return m_machine.configuration().contains(flaggedState);
+	return m_state;
 }
 
-bool Tile::isRevealed() const
+void Tile::setState(State state, unsigned int adjacentMineCount /*= 0*/)
 {
-	return m_machine.configuration().contains(revealedState);
-}
+	// restyling is the expensive part, so a tile only restyles when its look actually changes. That keeps resets and
+	// re-binding a scrolled tile to a new cell cheap.
+	const bool wasOpen         = m_state == Revealed || m_state == Mine;
+	const bool changedRevealed = m_state != Revealed || m_adjacentMineCount != adjacentMineCount;
+	const bool changedMine     = m_state != Mine;
 
-bool Tile::isUnrevealed() const
-{
-	return m_machine.configuration().contains(unrevealedState);
-}
-
-unsigned int Tile::adjacentFlaggedCount() const
-{
-	return m_adjacentFlaggedCount;
-}
-
-void Tile::incrementAdjacentFlaggedCount()
-{
-	++m_adjacentFlaggedCount;
-}
-
-void Tile::decrementAdjacentFlaggedCount()
-{
-	--m_adjacentFlaggedCount;
-}
+	m_state             = state;
+	m_adjacentMineCount = adjacentMineCount;
 
-QList<Tile*>& Tile::neighbors()
-{
-	return m_neighbors;
-}
-
-void Tile::mousePressEvent(QMouseEvent* e)
-{
-	if (!m_firstClick)
-	{
-		m_firstClick = true;
-		emit firstClick(this);
-	}
-
-	m_bothClicked = false;
-
-	if (e->buttons() == (Qt::LeftButton | Qt::RightButton))
+	switch (state)
 	{
-		emit bothClicked();
-		m_buttons = Qt::LeftButton | Qt::RightButton;
-	}
-	else if (e->buttons() == Qt::LeftButton)
-		m_buttons = Qt::LeftButton;
-	else if (e->buttons() == Qt::RightButton)
-		m_buttons = Qt::RightButton;
-}
-
-void Tile::mouseReleaseEvent(QMouseEvent* e)
-{
-	if (m_buttons == (Qt::LeftButton | Qt::RightButton))
-		emit unClicked();
-	else if (m_buttons == Qt::LeftButton)
-		emit leftClicked();
-	else if (m_buttons == Qt::RightButton)
-		emit rightClicked();
-}
-
-void Tile::mouseMoveEvent(QMouseEvent* e)
-{
-	if (e->buttons() == (Qt::LeftButton | Qt::RightButton))
-	{
-		if (!this->rect().contains(this->mapFromGlobal(QCursor::pos())))
-			emit unPreview();
-	}
-}
-
-QSize Tile::sizeHint() const
-{
-	return QSize(20, 20);
-}
-
-void Tile::createStateMachine()
-{
-	unrevealedState       = new QState;
-	previewState          = new QState;
-	previewNeighborsState = new QState;
-	flaggedState          = new QState;
-	revealedState         = new QState;
-	revealNeighborsState  = new QState;
-	disabledState         = new QFinalState;
-
-	unrevealedState->addTransition(this, &Tile::leftClicked, revealedState);
-	unrevealedState->addTransition(this, &Tile::rightClicked, flaggedState);
-	unrevealedState->addTransition(this, &Tile::reveal, revealedState);
-	unrevealedState->addTransition(this, &Tile::preview, previewState);
-	unrevealedState->addTransition(this, &Tile::disable, disabledState);
-
-	previewState->addTransition(this, &Tile::reveal, revealedState);
-	previewState->addTransition(this, &Tile::unPreview, unrevealedState);
-	previewState->addTransition(this, &Tile::disable, disabledState);
-
-	flaggedState->addTransition(this, &Tile::rightClicked, unrevealedState);
-
-	revealedState->addTransition(this, &Tile::bothClicked, previewNeighborsState);
-
-	previewNeighborsState->addTransition(this, &Tile::unClicked, revealNeighborsState);
-	previewNeighborsState->addTransition(this, &Tile::unPreview, revealedState);
-
-	revealNeighborsState->addTransition(this, &Tile::reveal, revealedState);
-
-	connect(unrevealedState, &QState::entered, [this]()
-	{
-		this->setIcon(blankIcon());
-		this->setStyleSheet(unrevealedStyleSheet);
-	});
-
-	connect(previewState, &QState::entered, [this]()
-	{
-		this->setStyleSheet(revealedStyleSheet);
-	});
-
-	connect(previewNeighborsState, &QState::entered, [this]()
-	{
-		for (auto neighbor : m_neighbors)
-			neighbor->preview();
-	});
-
-	connect(revealNeighborsState, &QState::entered, [this]()
-	{
-		if (m_adjacentFlaggedCount == m_adjacentMineCount && m_adjacentMineCount)
-			revealNeighbors();
-		else
-			unPreviewNeighbors();
-		emit reveal();
-	});
-
-	connect(revealedState, &QState::entered, [this]()
-	{
-		unPreviewNeighbors();
+	case Unrevealed: [[fallthrough]];
+	case Flagged: [[fallthrough]];
+	case WrongFlag:
+		this->setIcon(state == Flagged ? flagIcon() : state == WrongFlag ? wrongIcon() : blankIcon());
+		if (wasOpen)
+		{
+			QPushButton::setText("");
+			this->setChecked(false);
+			this->setStyleSheet(unrevealedStyleSheet);
+		}
+		break;
+	case Revealed:
 		this->setIcon(blankIcon());
-		this->setChecked(true);
-		if (!isMine())
+		if (changedRevealed)
 		{
+			this->setChecked(true);
 			setText();
-			if (!hasAdjacentMines())
-				revealNeighbors();
-			emit revealed();
 		}
-		else
+		break;
+	case Mine:
+		setIcon(mineIcon());
+		if (changedMine)
 		{
-			emit detonated();
+			this->setChecked(true);
 			this->setStyleSheet(revealedStyleSheet);
 			QPushButton::setText("");
-			setIcon(mineIcon());
 		}
-	});
-
-	connect(flaggedState, &QState::entered, [this]()
-	{
-		this->setIcon(flagIcon());
-		for (auto neighbor : m_neighbors)
-			neighbor->incrementAdjacentFlaggedCount();
-		emit flagged(m_isMine);
-	});
-
-	connect(flaggedState, &QState::exited, [this]()
-	{
-		for (auto neighbor : m_neighbors)
-			neighbor->decrementAdjacentFlaggedCount();
-		emit unFlagged(m_isMine);
-	});
-
-	connect(disabledState, &QState::entered, [this]()
-	{
-	});
+		break;
+	}
+}
 
-	m_machine.addState(unrevealedState);
-	m_machine.addState(previewState);
-	m_machine.addState(previewNeighborsState);
-	m_machine.addState(flaggedState);
-	m_machine.addState(revealedState);
-	m_machine.addState(revealNeighborsState);
-	m_machine.addState(disabledState);
+void Tile::setPreviewed(bool previewed)
+{
+	if (m_state == Unrevealed)
+		this->setStyleSheet(previewed ? revealedStyleSheet : unrevealedStyleSheet);
+}
 
-	m_machine.setInitialState(unrevealedState);
-	m_machine.start();
+QSize Tile::sizeHint() const
+{
+	return QSize(SIZE, SIZE);
 }
 
 void Tile::setText()
@@ -417,8 +239,7 @@ void Tile::setText()
 	}
 
 	QPushButton::setStyleSheet(revealedWithNumberStylesheet.arg(color));
-	if (m_adjacentMineCount)
-		QPushButton::setText(QString::number(m_adjacentMineCount));
+	QPushButton::setText(m_adjacentMineCount ? QString::number(m_adjacentMineCount) : QString());
 }
 
 void Tile::setTheme(Qt::ColorScheme colorScheme)
@@ -436,13 +257,17 @@ void Tile::setTheme(Qt::ColorScheme colorScheme)
 		revealedWithNumberStylesheet = revealedWithNumberStylesheetLight;
 	}
 
-	if (isUnrevealed() || isFlagged())
+	if (m_state == Unrevealed || m_state == Flagged || m_state == WrongFlag)
 	{
 		this->setStyleSheet(unrevealedStyleSheet);
 	}
-	if(isRevealed())
+	if (m_state == Revealed)
 	{
 		this->setStyleSheet(revealedStyleSheet);
 		setText();
 	}
+	if (m_state == Mine)
+	{
+		this->setStyleSheet(revealedStyleSheet);
+	}
 }
\ No newline at end of file
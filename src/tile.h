@@ -1,10 +1,6 @@
 #pragma once
 #include <QPushButton>
 #include <QList>
-#include <QStateMachine>
-#include <QState>
-#include <QFinalState>
-#include <QSignalMapper>
 
 struct TileLocation
 {
@@ -12,35 +8,37 @@ struct TileLocation
 	unsigned int column;
 };
 
+/// A single cell of the GameBoard. Tiles only display the state of their cell, the rules of the game live in BoardCore.
 class Tile : public QPushButton
 {
 private:
 
 	Q_OBJECT
 
+public:
+
+	enum State
+	{
+		Unrevealed,
+		Flagged,
+		Revealed,
+		Mine,
+		WrongFlag, ///< a flag on a cell without a mine, shown after a defeat
+	};
+
+	static constexpr int SIZE = 20; ///< width and height of a tile in pixels
+
 public:
 
 	Tile(TileLocation location, QWidget* parent = nullptr);
-	virtual ~Tile() override;
 
-	void addNeighbor(Tile* tile);
 	TileLocation location() const;
-	void placeMine(bool val);
-	
-	bool isMine() const;
-	bool isFlagged() const;
-	bool isRevealed() const;
-	bool isUnrevealed() const;
-	bool hasAdjacentMines() const;
-
-	unsigned int adjacentMineCount() const;
-	unsigned int adjacentFlaggedCount() const;
+	void         setLocation(TileLocation location);
+	State state() const;
 
-	QList<Tile*>& neighbors();
+	void setState(State state, unsigned int adjacentMineCount = 0);
+	void setPreviewed(bool previewed);
 
-	virtual void mousePressEvent(QMouseEvent* e) override;
-	virtual void mouseReleaseEvent(QMouseEvent* e) override;
-	virtual void mouseMoveEvent(QMouseEvent* e) override;
 	virtual QSize sizeHint() const override;
 
 	static QIcon blankIcon();
@@ -52,44 +50,17 @@ public:
 
 public slots:
 
-	void incrementAdjacentFlaggedCount();
-	void decrementAdjacentFlaggedCount();
-	void incrementAdjacentMineCount();
 	void setTheme(Qt::ColorScheme colorScheme);
 
-signals:
-
-	void firstClick(Tile*);
-	void leftClicked();
-	void rightClicked();
-	void bothClicked();
-	void unClicked();
-	void detonated();
-	void reveal();
-	void revealed();
-	void revealNeighbors();
-	void preview();
-	void unPreview();
-	void unPreviewNeighbors();
-	void flagged(bool);
-	void unFlagged(bool);
-	void disable();
-
 private:
 
-	void createStateMachine();
 	void setText();
 
 private:
 
-	bool m_isMine;
+	State m_state;
 	unsigned int m_adjacentMineCount;
-	unsigned int m_adjacentFlaggedCount;
 	TileLocation m_location;
-	QList<Tile*> m_neighbors;
-	bool m_bothClicked;
-	static bool m_firstClick;
-	Qt::MouseButtons m_buttons;
 	
 	static const QString unrevealedStyleSheetLight;
 	static const QString revealedStyleSheetLight;
@@ -101,13 +72,4 @@ private:
 	QString unrevealedStyleSheet;
 	QString revealedStyleSheet;
 	QString revealedWithNumberStylesheet;
-
-	QStateMachine m_machine;
-	QState* unrevealedState;
-	QState* previewState;
-	QState* previewNeighborsState;
-	QState* flaggedState;
-	QState* revealedState;
-	QState* revealNeighborsState;
-	QFinalState* disabledState;
 };
\ No newline at end of file
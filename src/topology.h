@@ -0,0 +1,168 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       topology.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Neighbor topologies of the board.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef TOPOLOGY_H
+#define TOPOLOGY_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include <QtGlobal>
+
+//----------------------------------------------------------------------------------------------------------------------
+//      TOPOLOGIES
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Which cells count as neighbors, as a policy for `BasicBoardCore`.
+/// @details A topology is a stateless type with
+///          - `MAX_NEIGHBORS`, the most neighbors any cell can have,
+///          - `SEPARABLE`, set when the neighborhood is the plain 3x3 square, so mines can be counted with a
+///            separable sum instead of per mine,
+///          - `forEachNeighbor(rows, columns, row, column, function)`, which calls `function(row, column)` once for
+///            every distinct neighbor.
+///
+///          The core is instantiated on its topology, so the neighbor loops are inlined into the flood fill, the mine
+///          placement and the counts, and the square grid compiles to the same code it always has.
+//----------------------------------------------------------------------------------------------------------------------
+
+/// the classic board: the 8 cells around a cell, clipped at the edges
+struct RectangularTopology
+{
+	static constexpr unsigned int MAX_NEIGHBORS = 8;
+	static constexpr bool         SEPARABLE     = true;
+
+	template <class Function>
+	static void forEachNeighbor(quint32 rows, quint32 columns, quint32 r, quint32 c, Function&& function)
+	{
+		const quint32 firstRow = r ? r - 1 : r;
+		const quint32 lastRow  = r + 1 < rows ? r + 1 : r;
+		const quint32 firstCol = c ? c - 1 : c;
+		const quint32 lastCol  = c + 1 < columns ? c + 1 : c;
+
+		for (quint32 nr = firstRow; nr <= lastRow; ++nr)
+		{
+			for (quint32 nc = firstCol; nc <= lastCol; ++nc)
+			{
+				if (nr != r || nc != c)
+					function(nr, nc);
+			}
+		}
+	}
+};
+
+/// the 8 cells around a cell, wrapping around the edges so the board has none
+struct ToroidalTopology
+{
+	static constexpr unsigned int MAX_NEIGHBORS = 8;
+	static constexpr bool         SEPARABLE     = false;
+
+	template <class Function>
+	static void forEachNeighbor(quint32 rows, quint32 columns, quint32 r, quint32 c, Function&& function)
+	{
+		// on a board less than three cells across, both directions wrap onto the same cell, which only counts once
+		const int firstDr = rows >= 3 ? -1 : 0;
+		const int lastDr  = rows >= 2 ? 1 : 0;
+		const int firstDc = columns >= 3 ? -1 : 0;
+		const int lastDc  = columns >= 2 ? 1 : 0;
+
+		for (int dr = firstDr; dr <= lastDr; ++dr)
+		{
+			for (int dc = firstDc; dc <= lastDc; ++dc)
+			{
+				if (dr || dc)
+					function(wrap(r, dr, rows), wrap(c, dc, columns));
+			}
+		}
+	}
+
+private:
+
+	static quint32 wrap(quint32 value, int delta, quint32 size) noexcept
+	{
+		if (delta < 0)
+			return value ? value - 1 : size - 1;
+		if (delta > 0)
+			return value + 1 < size ? value + 1 : 0;
+		return value;
+	}
+};
+
+/// hexagonal cells in "odd-r" offset coordinates: odd rows are shifted half a cell to the right, which gives every
+/// cell 2 neighbors in its own row and 2 in each of the rows above and below
+struct HexagonalTopology
+{
+	static constexpr unsigned int MAX_NEIGHBORS = 6;
+	static constexpr bool         SEPARABLE     = false;
+
+	template <class Function>
+	static void forEachNeighbor(quint32 rows, quint32 columns, quint32 r, quint32 c, Function&& function)
+	{
+		// the two neighbors in the rows above and below are at columns c - 1 and c on even rows, c and c + 1 on odd
+		const qint64 column = c;
+		const qint64 shift  = r & 1;
+		if (c > 0)
+			function(r, c - 1);
+		if (c + 1 < columns)
+			function(r, c + 1);
+
+		for (const qint64 nr : {static_cast<qint64>(r) - 1, static_cast<qint64>(r) + 1})
+		{
+			if (nr < 0 || nr >= rows)
+				continue;
+			for (const qint64 nc : {column - 1 + shift, column + shift})
+			{
+				if (nc >= 0 && nc < columns)
+					function(static_cast<quint32>(nr), static_cast<quint32>(nc));
+			}
+		}
+	}
+};
+
+/// the cells a chess knight reaches in one move
+struct KnightTopology
+{
+	static constexpr unsigned int MAX_NEIGHBORS = 8;
+	static constexpr bool         SEPARABLE     = false;
+
+	template <class Function>
+	static void forEachNeighbor(quint32 rows, quint32 columns, quint32 r, quint32 c, Function&& function)
+	{
+		constexpr int offsets[MAX_NEIGHBORS][2] = {{-2, -1}, {-2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}, {2, -1}, {2, 1}};
+		for (const auto& [dr, dc] : offsets)
+		{
+			const qint64 nr = static_cast<qint64>(r) + dr;
+			const qint64 nc = static_cast<qint64>(c) + dc;
+			if (nr >= 0 && nr < rows && nc >= 0 && nc < columns)
+				function(static_cast<quint32>(nr), static_cast<quint32>(nc));
+		}
+	}
+};
+
+#endif // TOPOLOGY_H
\ No newline at end of file
@@ -0,0 +1,139 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       trace.cpp
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+/// @copyright  (c) 2026 STR. The use of this software is subject to the terms and conditions outlined
+///             in the LICENSE file. By using this software, the user agrees to be bound by the terms and
+///             conditions set forth in the LICENSE file.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @details    Implementation file for `trace.h`.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include "trace.h"
+
+#include <QFile>
+#include <QTextStream>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+//----------------------------
+//  LOCAL DEFINITIONS
+//----------------------------
+
+namespace
+{
+	/// Events are dropped once a thread's buffer is full, so recording stays allocation and lock free.
+	constexpr size_t EVENTS_PER_THREAD = 1 << 16;
+
+	struct TraceEvent
+	{
+		const char* name;
+		qint64      begin; // nanoseconds since traceEpoch
+		qint64      end;   // nanoseconds since traceEpoch, or the value of a counter
+		bool        counter;
+	};
+
+	struct ThreadBuffer
+	{
+		explicit ThreadBuffer(quint32 threadId)
+			: tid(threadId)
+		{
+		}
+
+		quint32                                   tid;
+		std::atomic<size_t>                       count{0};
+		std::array<TraceEvent, EVENTS_PER_THREAD> events;
+	};
+
+	const Trace::Clock::time_point traceEpoch = Trace::Clock::now();
+
+	std::mutex                                 registryMutex;
+	std::vector<std::unique_ptr<ThreadBuffer>> registry; // buffers outlive their threads so pool threads can retire
+
+	qint64 sinceEpoch(Trace::Clock::time_point t) noexcept
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(t - traceEpoch).count();
+	}
+
+	ThreadBuffer* threadBuffer()
+	{
+		thread_local ThreadBuffer* buffer = []()
+		{
+			std::lock_guard lock(registryMutex);
+			registry.push_back(std::make_unique<ThreadBuffer>(static_cast<quint32>(registry.size() + 1)));
+			return registry.back().get();
+		}();
+		return buffer;
+	}
+
+	void append(const TraceEvent& event) noexcept
+	{
+		// only the owning thread writes to its buffer, so a relaxed load of our own count is sufficient. The release
+		// store publishes the event to writeChromeTrace.
+		ThreadBuffer* buffer = threadBuffer();
+		const size_t  index  = buffer->count.load(std::memory_order_relaxed);
+		if (index >= EVENTS_PER_THREAD)
+			return;
+
+		buffer->events[index] = event;
+		buffer->count.store(index + 1, std::memory_order_release);
+	}
+} // namespace
+
+//======================================================================================================================
+//      MEMBER FUNCTIONS
+//======================================================================================================================
+
+void Trace::record(const char* name, Clock::time_point begin, Clock::time_point end) noexcept
+{
+	append({name, sinceEpoch(begin), sinceEpoch(end), false});
+}
+
+void Trace::count(const char* name, qint64 value) noexcept
+{
+	append({name, sinceEpoch(Clock::now()), value, true});
+}
+
+bool Trace::writeChromeTrace(const QString& fileName)
+{
+	QFile file(fileName);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate))
+		return false;
+
+	QTextStream stream(&file);
+	stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+	bool            first = true;
+	std::lock_guard lock(registryMutex);
+	for (const auto& buffer : registry)
+	{
+		const size_t count = buffer->count.load(std::memory_order_acquire);
+		for (size_t i = 0; i < count; ++i)
+		{
+			const TraceEvent& event = buffer->events[i];
+			stream << (first ? "\n" : ",\n");
+			stream << "{\"name\":\"" << event.name << "\",\"ph\":\"" << (event.counter ? "C" : "X") << "\",\"pid\":1,\"tid\":" << buffer->tid;
+			stream << ",\"ts\":" << QString::number(event.begin / 1000.0, 'f', 3);
+			if (event.counter)
+				stream << ",\"args\":{\"value\":" << event.end << "}}";
+			else
+				stream << ",\"dur\":" << QString::number((event.end - event.begin) / 1000.0, 'f', 3) << "}";
+			first = false;
+		}
+	}
+
+	stream << "\n]}\n";
+	return stream.status() == QTextStream::Ok;
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @file       trace.h
+/// @author     Nic Holthaus
+/// @date       10/19/2026
+///
+/// @copyright The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+/// and associated documentation files (the "Software"), to deal in the Software without
+/// restriction, including without limitation the rights to use, copy, modify, merge, publish,
+/// distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all copies or
+/// substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+/// BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+/// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+/// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// ---------------------------------------------------------------------------------------------------------------------
+//
+/// @brief      Definition of the `Trace` Class.
+/// @details
+//
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef TRACE_H
+#define TRACE_H
+
+//----------------------------
+//  INCLUDES
+//----------------------------
+
+#include <QString>
+
+#include <chrono>
+
+//----------------------------
+//  MACROS
+//----------------------------
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b)      TRACE_CONCAT_IMPL(a, b)
+
+/// Records a Chrome trace "complete" event spanning the enclosing scope. `name` must be a string literal.
+/// Compiles to nothing unless the `MINESWEEPER_TRACING` CMake option is enabled.
+#ifdef MINESWEEPER_TRACING
+#define TRACE_SCOPE(name) const Trace::Zone TRACE_CONCAT(traceZone_, __LINE__){name}
+#else
+#define TRACE_SCOPE(name) static_cast<void>(0)
+#endif
+
+/// Records a Chrome trace "counter" event, a sample of `value` shown as a graph over time. `name` must be a string
+/// literal. Compiles to nothing unless the `MINESWEEPER_TRACING` CMake option is enabled.
+#ifdef MINESWEEPER_TRACING
+#define TRACE_COUNTER(name, value) Trace::count(name, value)
+#else
+#define TRACE_COUNTER(name, value) static_cast<void>(0)
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+//      CLASS: Trace
+//----------------------------------------------------------------------------------------------------------------------
+/// @brief Lightweight scoped-zone profiler which writes Chrome trace / Perfetto compatible JSON.
+/// @details Each thread appends to its own fixed-size buffer, so recording a zone never takes a lock. Buffers are only
+///          registered (once per thread) and read back when the trace is written.
+//----------------------------------------------------------------------------------------------------------------------
+class Trace
+{
+public:
+
+	using Clock = std::chrono::steady_clock;
+
+	class Zone
+	{
+	public:
+
+		explicit Zone(const char* name) noexcept
+			: m_name(name)
+			, m_begin(Clock::now())
+		{
+		}
+
+		~Zone() { Trace::record(m_name, m_begin, Clock::now()); }
+
+		Zone(const Zone&)            = delete;
+		Zone& operator=(const Zone&) = delete;
+
+	private:
+
+		const char*       m_name;
+		Clock::time_point m_begin;
+	};
+
+public:
+
+	static void record(const char* name, Clock::time_point begin, Clock::time_point end) noexcept;
+	static void count(const char* name, qint64 value) noexcept;
+	static bool writeChromeTrace(const QString& fileName);
+};
+
+#endif // TRACE_H
\ No newline at end of file